@@ -6,6 +6,67 @@
 #include <type_traits>
 #include <cctype>
 #include <algorithm>
+#include <new>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <map>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <fstream>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define STRING_HAS_SSE2 1
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define STRING_HAS_SSSE3 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__has_include)
+#if __has_include(<format>) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#include <format>
+#endif
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define STRING_HAS_AVX2 1
+#endif
+
+// Попередня вибірка в кеш (підказка; без підтримки компілятора — нічого)
+#if defined(__GNUC__) || defined(__clang__)
+#define STRING_PREFETCH(p) __builtin_prefetch(p)
+#elif defined(STRING_HAS_SSE2)
+#define STRING_PREFETCH(p) _mm_prefetch(reinterpret_cast<const char*>(p), _MM_HINT_T0)
+#else
+#define STRING_PREFETCH(p) ((void)0)
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(STRING_BENCHMARKS)
+#include <thread>
+#endif
+
+#if defined(STRING_BENCHMARKS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
 
 // Винятки 
 class StringException : public std::exception {
@@ -26,291 +87,6689 @@ public:
     InvalidRangeException() : StringException("Invalid pointer range.") {}
 };
 
-// Абстрактна трансформація
-template <typename T>
-struct Transformer {
-    virtual T operator()(const T&) const = 0;
-    virtual ~Transformer() = default;
+class OperationCancelledException : public StringException {
+public:
+    explicit OperationCancelledException(bool deadline)
+        : StringException(deadline ? "Operation deadline exceeded." : "Operation cancelled.") {}
 };
 
-// Клас String<T> 
-template <typename T>
-class String {
-    T* data = nullptr;
-    size_t length = 0;
-
-    void copy_from(const T* source, size_t len) {
-        data = new T[len];
-        for (size_t i = 0; i < len; ++i) data[i] = source[i];
-        length = len;
-    }
+class MemoryBudgetExceededException : public StringException {
+public:
+    MemoryBudgetExceededException(size_t requested, size_t limit)
+        : StringException("Memory budget exceeded: " + std::to_string(requested) + " bytes requested, hard limit " +
+                          std::to_string(limit) + " bytes.") {}
+};
 
+// Пул коротких буферів
+// Кожен потік має власну купу зі списками вільних блоків за класами розміру (16..256 байтів).
+// Блоки нарізаються зі слебів по 64 КіБ; власника блоку знаходимо за адресою слеба.
+// Чужі блоки накопичуються пачками й передаються власнику одним CAS.
+class StringPool {
 public:
-    // Конструктори
-    String() = default;
+    static constexpr size_t kMinBlock = 16;
+    static constexpr size_t kMaxBlock = 256;
+    static constexpr size_t kClassCount = 5;
+    static constexpr size_t kSlabSize = 64 * 1024;
+    static constexpr size_t kRemoteBatch = 32;
 
-    String(const String& other) {
-        copy_from(other.data, other.length);
+    static size_t class_index(size_t bytes) {
+        size_t idx = 0;
+        while ((kMinBlock << idx) < bytes) ++idx;
+        return idx;
     }
 
-    String(String&& other) noexcept : data(other.data), length(other.length) {
-        other.data = nullptr;
-        other.length = 0;
-    }
+    static size_t class_size(size_t idx) { return kMinBlock << idx; }
 
-    String(size_t count, const T& ch) {
-        data = new T[count];
-        for (size_t i = 0; i < count; ++i) data[i] = ch;
-        length = count;
+    static void* allocate(size_t bytes) {
+        size_t cls = class_index(bytes);
+        Heap* heap = local_heap();
+        if (!heap) {
+            // Потік уже завершується: беремо осиротілу купу під глобальним замком
+            std::lock_guard<std::mutex> lock(orphans_mutex());
+            Heap*& head = orphans();
+            if (!head) head = new Heap();
+            return head->pop(cls);
+        }
+        return heap->pop(cls);
     }
 
-    String(const T* cstr) {
-        if constexpr (std::is_same<T, char>::value) {
-            length = std::strlen(cstr);
+    static void deallocate(void* p, size_t) {
+        Block* block = static_cast<Block*>(p);
+        Heap* owner = slab_of(p)->owner;
+        Heap* heap = local_heap();
+        if (heap == owner) {
+            owner->push_local(block);
+        } else if (heap) {
+            heap->send_remote(owner, block);
         } else {
-            length = 0;
-            while (!(cstr[length] == T())) ++length;
+            owner->receive(block, block);
         }
-        copy_from(cstr, length);
     }
 
-    String(const T* begin, const T* end) {
-        if (begin > end) throw InvalidRangeException();
-        size_t len = end - begin;
-        copy_from(begin, len);
+private:
+    struct Block {
+        Block* next;
+    };
+
+    struct Heap;
+
+    struct alignas(64) Slab {
+        Heap* owner;
+        size_t cls;
+    };
+
+    // Пачка блоків, звільнених цим потоком для іншої купи
+    struct Outbox {
+        Heap* owner = nullptr;
+        Block* head = nullptr;
+        Block* tail = nullptr;
+        size_t count = 0;
+    };
+
+    struct Heap {
+        Block* local[kClassCount] = {};
+        Outbox outbox[4];
+        size_t nextOutbox = 0;
+        Heap* nextOrphan = nullptr;
+        alignas(64) std::atomic<Block*> remote{nullptr};
+
+        void* pop(size_t cls) {
+            if (!local[cls]) drain_remote();
+            if (!local[cls]) carve_slab(cls);
+            Block* b = local[cls];
+            local[cls] = b->next;
+            return b;
+        }
+
+        void push_local(Block* b) {
+            size_t cls = slab_of(b)->cls;
+            b->next = local[cls];
+            local[cls] = b;
+        }
+
+        // Приймання ланцюжка head..tail від інших потоків
+        void receive(Block* head, Block* tail) {
+            Block* old = remote.load(std::memory_order_relaxed);
+            do {
+                tail->next = old;
+            } while (!remote.compare_exchange_weak(old, head, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        void drain_remote() {
+            Block* b = remote.exchange(nullptr, std::memory_order_acquire);
+            while (b) {
+                Block* next = b->next;
+                push_local(b);
+                b = next;
+            }
+        }
+
+        void carve_slab(size_t cls) {
+            char* mem = static_cast<char*>(::operator new(kSlabSize, std::align_val_t(kSlabSize)));
+            Slab* slab = reinterpret_cast<Slab*>(mem);
+            slab->owner = this;
+            slab->cls = cls;
+            size_t size = class_size(cls);
+            size_t count = (kSlabSize - sizeof(Slab)) / size;
+            for (size_t i = count; i-- > 0;) {
+                Block* b = reinterpret_cast<Block*>(mem + sizeof(Slab) + i * size);
+                b->next = local[cls];
+                local[cls] = b;
+            }
+        }
+
+        void send_remote(Heap* owner, Block* b) {
+            Outbox* box = nullptr;
+            for (Outbox& o : outbox)
+                if (o.owner == owner) box = &o;
+            if (!box) {
+                box = &outbox[nextOutbox];
+                nextOutbox = (nextOutbox + 1) % 4;
+                flush(*box);
+                box->owner = owner;
+            }
+            b->next = box->head;
+            box->head = b;
+            if (!box->tail) box->tail = b;
+            if (++box->count == kRemoteBatch) flush(*box);
+        }
+
+        static void flush(Outbox& box) {
+            if (box.head) box.owner->receive(box.head, box.tail);
+            box.head = box.tail = nullptr;
+            box.count = 0;
+        }
+
+        void flush_all() {
+            for (Outbox& o : outbox) flush(o);
+        }
+    };
+
+    // Прив'язка купи до потоку; при завершенні потоку купа стає осиротілою і чекає нового власника
+    struct ThreadBinding {
+        Heap* heap = nullptr;
+        ~ThreadBinding() {
+            if (!heap) return;
+            heap->flush_all();
+            std::lock_guard<std::mutex> lock(orphans_mutex());
+            heap->nextOrphan = orphans();
+            orphans() = heap;
+            current() = nullptr;
+            finished() = true;
+        }
+    };
+
+    static Slab* slab_of(void* p) {
+        return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(p) & ~uintptr_t(kSlabSize - 1));
     }
 
-    template <typename U>
-    String(const String<U>& other) {
-        length = other.size();
-        data = new T[length];
-        for (size_t i = 0; i < length; ++i) data[i] = static_cast<T>(other[i]);
+    static Heap*& current() {
+        static thread_local Heap* heap = nullptr;
+        return heap;
     }
 
-    ~String() { delete[] data; }
+    static bool& finished() {
+        static thread_local bool done = false;
+        return done;
+    }
 
-    // Присвоєння
-    String& operator=(const String& other) {
-        if (this != &other) {
-            delete[] data;
-            copy_from(other.data, other.length);
+    static std::mutex& orphans_mutex() {
+        static std::mutex* m = new std::mutex();
+        return *m;
+    }
+
+    static Heap*& orphans() {
+        static Heap* head = nullptr;
+        return head;
+    }
+
+    static Heap* local_heap() {
+        Heap* heap = current();
+        if (heap || finished()) return heap;
+        {
+            std::lock_guard<std::mutex> lock(orphans_mutex());
+            Heap*& head = orphans();
+            if (head) {
+                heap = head;
+                head = heap->nextOrphan;
+                heap->nextOrphan = nullptr;
+            }
         }
-        return *this;
+        if (!heap) heap = new Heap();
+        static thread_local ThreadBinding binding;
+        binding.heap = heap;
+        current() = heap;
+        return heap;
     }
+};
 
-    String& operator=(String&& other) noexcept {
-        if (this != &other) {
-            delete[] data;
-            data = other.data;
-            length = other.length;
-            other.data = nullptr;
-            other.length = 0;
+// Пам'ять для буферів String<T>
+// До kMaxBlock — пул коротких буферів, до kAlignedThreshold — звичайний operator new, далі — вирівнювання на 64 байти
+// (для SIMD-ядер), від kHugeThreshold — mmap + MADV_HUGEPAGE і ріст через mremap.
+// Рівень визначається місткістю буфера, тому deallocate потребує ту саму місткість.
+struct StringMemory {
+    static constexpr size_t kAlignment = 64;
+    static constexpr size_t kAlignedThreshold = 4096;
+    static constexpr size_t kHugeThreshold = size_t(2) * 1024 * 1024;
+
+    // Округлення місткості до межі свого рівня
+    static size_t round_capacity(size_t bytes) {
+        if (bytes >= kHugeThreshold) return round_up(bytes, kHugeThreshold);
+        if (bytes >= kAlignedThreshold) return round_up(bytes, kAlignment);
+        if (bytes > 0 && bytes <= StringPool::kMaxBlock)
+            return StringPool::class_size(StringPool::class_index(bytes));
+        return bytes;
+    }
+
+    static void* allocate(size_t bytes) {
+        if (bytes == 0) return nullptr;
+#if defined(__unix__) || defined(__APPLE__)
+        if (bytes >= kHugeThreshold) {
+            void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+            madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+            return p;
         }
-        return *this;
+#endif
+        if (bytes >= kAlignedThreshold) return ::operator new(bytes, std::align_val_t(kAlignment));
+        if (bytes <= StringPool::kMaxBlock) return StringPool::allocate(bytes);
+        return ::operator new(bytes);
     }
 
-    // Методи доступу
-    size_t size() const { return length; }
-    bool empty() const { return length == 0; }
-    void clear() {
-        delete[] data;
-        data = nullptr;
-        length = 0;
+    static void deallocate(void* p, size_t bytes) {
+        if (!p) return;
+#if defined(__unix__) || defined(__APPLE__)
+        if (bytes >= kHugeThreshold) {
+            munmap(p, bytes);
+            return;
+        }
+#endif
+        if (bytes >= kAlignedThreshold) ::operator delete(p, std::align_val_t(kAlignment));
+        else if (bytes <= StringPool::kMaxBlock) StringPool::deallocate(p, bytes);
+        else ::operator delete(p);
     }
 
-    T& operator[](size_t index) {
-        if (index >= length) throw OutOfRangeException(index);
-        return data[index];
+    // Зміна місткості зі збереженням перших used байтів (на Linux великі буфери — без копіювання)
+    static void* reallocate(void* p, size_t oldBytes, size_t newBytes, size_t used) {
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+        if (p && oldBytes >= kHugeThreshold && newBytes >= kHugeThreshold) {
+            void* q = mremap(p, oldBytes, newBytes, MREMAP_MAYMOVE);
+            if (q == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+            madvise(q, newBytes, MADV_HUGEPAGE);
+#endif
+            return q;
+        }
+#endif
+        void* q = allocate(newBytes);
+        if (used) std::memcpy(q, p, used);
+        deallocate(p, oldBytes);
+        return q;
     }
 
-    const T& operator[](size_t index) const {
-        if (index >= length) throw OutOfRangeException(index);
-        return data[index];
+private:
+    static size_t round_up(size_t n, size_t unit) {
+        if (n > SIZE_MAX - unit) throw std::bad_alloc();
+        return (n + unit - 1) / unit * unit;
     }
+};
 
-    String substr(size_t start, size_t len) const {
-        if (start > length) throw OutOfRangeException(start);
-        size_t actualLen = std::min(len, length - start);
-        return String(data + start, data + start + actualLen);
+// Бюджет пам'яті буферів String<T> на весь процес (0 — без обмеження)
+// Кожне виділення спершу резервується в бюджеті. Перетин м'якого ліміту викликає зареєстровані
+// обробники (скинути кеші, вивантажити на диск); запит понад жорсткий ліміт відхиляється
+// MemoryBudgetExceededException ще до звернення до алокатора. Прийняті чужі буфери не враховуються.
+class MemoryBudget {
+public:
+    using Callback = std::function<void(size_t used, size_t softLimit)>;
+
+    static void set_limits(size_t soft, size_t hard) {
+        state().soft.store(soft, std::memory_order_relaxed);
+        state().hard.store(hard, std::memory_order_relaxed);
     }
 
-    // Оператори конкатенації
-    String operator+(const String& other) const {
-        String result;
-        result.data = new T[length + other.length];
-        for (size_t i = 0; i < length; ++i) result.data[i] = data[i];
-        for (size_t i = 0; i < other.length; ++i) result.data[length + i] = other.data[i];
-        result.length = length + other.length;
-        return result;
+    static size_t used() { return state().used.load(std::memory_order_relaxed); }
+    static size_t soft_limit() { return state().soft.load(std::memory_order_relaxed); }
+    static size_t hard_limit() { return state().hard.load(std::memory_order_relaxed); }
+
+    // Обробник викликається щоразу, коли використання переходить м'який ліміт знизу вгору
+    static size_t on_soft_limit(Callback callback) {
+        State& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.callbacks.emplace_back(++s.nextId, std::move(callback));
+        return s.nextId;
     }
 
-    String& operator+=(const T& ch) {
-        T* newData = new T[length + 1];
-        for (size_t i = 0; i < length; ++i) newData[i] = data[i];
-        newData[length] = ch;
-        delete[] data;
-        data = newData;
-        ++length;
-        return *this;
+    static void remove_callback(size_t id) {
+        State& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for (size_t i = 0; i < s.callbacks.size(); ++i)
+            if (s.callbacks[i].first == id) {
+                s.callbacks.erase(s.callbacks.begin() + i);
+                break;
+            }
     }
 
-    // Трансформації
-    void apply(const Transformer<T>& transformer) {
-        for (size_t i = 0; i < length; ++i) data[i] = transformer(data[i]);
+    static void charge(size_t bytes) {
+        if (!bytes) return;
+        State& s = state();
+        size_t before = s.used.fetch_add(bytes, std::memory_order_relaxed);
+        size_t after = before + bytes;
+        size_t hard = s.hard.load(std::memory_order_relaxed);
+        if (hard && (after > hard || after < before)) {
+            s.used.fetch_sub(bytes, std::memory_order_relaxed);
+            throw MemoryBudgetExceededException(bytes, hard);
+        }
+        size_t soft = s.soft.load(std::memory_order_relaxed);
+        if (soft && before <= soft && after > soft) {
+            // Виняток з обробника скасовує виділення, тож резерв теж знімається
+            try {
+                notify(after, soft);
+            } catch (...) {
+                s.used.fetch_sub(bytes, std::memory_order_relaxed);
+                throw;
+            }
+        }
     }
 
-    template <typename Trans>
-    void modify(const Trans& transformer) {
-        for (size_t i = 0; i < length; ++i) data[i] = transformer(data[i]);
+    static void release(size_t bytes) noexcept {
+        if (bytes) state().used.fetch_sub(bytes, std::memory_order_relaxed);
     }
 
-    template <typename Trans>
-    String transformed(const Trans& transformer) const {
-        String result;
-        result.data = new T[length];
-        for (size_t i = 0; i < length; ++i) result.data[i] = transformer(data[i]);
-        result.length = length;
-        return result;
+private:
+    struct State {
+        std::atomic<size_t> used{0};
+        std::atomic<size_t> soft{0};
+        std::atomic<size_t> hard{0};
+        std::mutex mutex;
+        std::vector<std::pair<size_t, Callback>> callbacks;
+        size_t nextId = 0;
+    };
+
+    // Не знищується при завершенні: статичні рядки можуть звільнятися пізніше
+    static State& state() {
+        static State* s = new State;
+        return *s;
     }
 
-    String transformed(const Transformer<T>& transformer) const {
-        return transformed<T>([&transformer](const T& c) { return transformer(c); });
+    // Обробники працюють поза м'ютексом і можуть самі виділяти чи звільняти рядки
+    static void notify(size_t used, size_t soft) {
+        static thread_local bool inCallback = false;
+        if (inCallback) return;
+        std::vector<std::pair<size_t, Callback>> snapshot;
+        {
+            std::lock_guard<std::mutex> lock(state().mutex);
+            snapshot = state().callbacks;
+        }
+        inCallback = true;
+        try {
+            for (auto& c : snapshot) c.second(used, soft);
+        } catch (...) {
+            inCallback = false;
+            throw;
+        }
+        inCallback = false;
     }
+};
 
-    // Доступ до data (для зовнішніх операторів)
-    const T* c_str() const { return data ? data : ""; }
+// Кооперативне скасування тривалих операцій
+// Токен передається необов'язковим параметром (nullptr — без перевірок). Масові ядра перевіряють
+// його між блоками по kCheckInterval елементів і перериваються OperationCancelledException.
+class CancellationToken {
+public:
+    static constexpr size_t kCheckInterval = size_t(1) << 16;
+    using Clock = std::chrono::steady_clock;
 
-    // Друзі для операторів
-    template <typename U>
-    friend String<U> operator+(const String<U>& s, const U& ch);
+    CancellationToken() = default;
+    explicit CancellationToken(Clock::duration timeout) { set_deadline(Clock::now() + timeout); }
 
-    template <typename U>
-    friend String<U> operator+(const U& ch, const String<U>& s);
+    CancellationToken(const CancellationToken&) = delete;
+    CancellationToken& operator=(const CancellationToken&) = delete;
 
-    template <typename U>
-    friend String<U> operator*(const String<U>& s, int times);
+    // Можна викликати з іншого потоку
+    void cancel() { flag.store(true, std::memory_order_release); }
 
-    template <typename U>
-    friend String<U> operator*(int times, const String<U>& s);
+    void set_deadline(Clock::time_point deadline) {
+        deadlineTicks.store(deadline.time_since_epoch().count(), std::memory_order_release);
+    }
 
-    template <typename U>
-    friend bool operator==(const String<U>& a, const String<U>& b);
+    bool cancelled() const { return flag.load(std::memory_order_acquire) || expired(); }
 
-    template <typename U>
-    friend bool operator!=(const String<U>& a, const String<U>& b);
+    void check() const {
+        if (flag.load(std::memory_order_acquire)) throw OperationCancelledException(false);
+        if (expired()) throw OperationCancelledException(true);
+    }
 
-    template <typename U>
-    friend bool operator<(const String<U>& a, const String<U>& b);
+private:
+    static constexpr Clock::rep kNoDeadline = std::numeric_limits<Clock::rep>::max();
 
-    template <typename U>
-    friend bool operator>(const String<U>& a, const String<U>& b);
+    std::atomic<bool> flag{false};
+    std::atomic<Clock::rep> deadlineTicks{kNoDeadline};
 
-    template <typename U>
-    friend bool operator<=(const String<U>& a, const String<U>& b);
+    bool expired() const {
+        Clock::rep deadline = deadlineTicks.load(std::memory_order_acquire);
+        return deadline != kNoDeadline && Clock::now().time_since_epoch().count() >= deadline;
+    }
+};
 
-    template <typename U>
-    friend bool operator>=(const String<U>& a, const String<U>& b);
+// Виконує body(begin, end) над [0, n) блоками, перевіряючи токен перед кожним блоком
+template <typename Body>
+void for_each_chunk(size_t n, const CancellationToken* token, Body body) {
+    if (!token) {
+        body(size_t(0), n);
+        return;
+    }
+    for (size_t begin = 0; begin < n;) {
+        token->check();
+        size_t end = n - begin > CancellationToken::kCheckInterval ? begin + CancellationToken::kCheckInterval : n;
+        body(begin, end);
+        begin = end;
+    }
+}
 
-    // Оператори вводу/виводу оголошуємо друзями (тільки для char)
-    friend std::ostream& operator<<(std::ostream& os, const String<char>& str);
-    friend std::istream& operator>>(std::istream& is, String<char>& str);
+// Абстрактна трансформація
+template <typename T>
+struct Transformer {
+    virtual T operator()(const T&) const = 0;
+    virtual ~Transformer() = default;
 };
 
-// Реалізація друкованих і ввідних операторів поза класом
+// Номер молодшого/старшого встановленого біта (x != 0)
+inline unsigned count_trailing_zeros(unsigned x) {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return unsigned(i);
+#else
+    return unsigned(__builtin_ctz(x));
+#endif
+}
 
-std::ostream& operator<<(std::ostream& os, const String<char>& str) {
-    for (size_t i = 0; i < str.size(); ++i) {
-        os << str[i];
-    }
-    return os;
+inline unsigned count_leading_zeros32(unsigned x) {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanReverse(&i, x);
+    return 31 - unsigned(i);
+#else
+    return unsigned(__builtin_clz(x));
+#endif
 }
 
-std::istream& operator>>(std::istream& is, String<char>& str) {
-    std::string temp;
-    is >> temp;
-    str = String<char>(temp.c_str());
-    return is;
+inline unsigned count_leading_zeros64(uint64_t x) {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanReverse64(&i, x);
+    return 63 - unsigned(i);
+#else
+    return unsigned(__builtin_clzll(x));
+#endif
 }
 
-// Оператори конкатенації та повторення
+// Розворот елементів; для простих типів розміром 1, 2 або 4 байти — по 16 байтів у SSE2-регістрах
+#ifdef STRING_HAS_SSE2
+template <size_t Size>
+inline __m128i reverse_block(__m128i v) {
+    v = _mm_shuffle_epi32(v, 0x1B);
+    if constexpr (Size <= 2) v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+    if constexpr (Size == 1) v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    return v;
+}
+#endif
 
 template <typename T>
-String<T> operator+(const String<T>& s, const T& ch) {
-    String<T> result = s;
-    result += ch;
-    return result;
-}
+constexpr bool kSimdReversible = std::is_trivially_copyable<T>::value && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4);
 
 template <typename T>
-String<T> operator+(const T& ch, const String<T>& s) {
-    String<T> result(1, ch);
-    return result + s;
+void reverse_elements(T* p, size_t n) {
+#ifdef STRING_HAS_SSE2
+    if constexpr (kSimdReversible<T>) {
+        constexpr size_t k = 16 / sizeof(T);
+        size_t i = 0, j = n;
+        while (j - i >= 2 * k) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + j - k));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), reverse_block<sizeof(T)>(b));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p + j - k), reverse_block<sizeof(T)>(a));
+            i += k;
+            j -= k;
+        }
+        std::reverse(p + i, p + j);
+        return;
+    }
+#endif
+    std::reverse(p, p + n);
 }
 
+// Запис src[0, n) у dst у зворотному порядку (області не перетинаються)
 template <typename T>
-String<T> operator*(const String<T>& s, int times) {
-    if (times <= 0) return String<T>();
-    String<T> result;
-    result.data = new T[s.length * times];
-    for (int t = 0; t < times; ++t)
-        for (size_t i = 0; i < s.length; ++i)
-            result.data[t * s.length + i] = s.data[i];
-    result.length = s.length * times;
-    return result;
+void reverse_copy_elements(const T* src, size_t n, T* dst) {
+    size_t i = 0;
+#ifdef STRING_HAS_SSE2
+    if constexpr (kSimdReversible<T>) {
+        constexpr size_t k = 16 / sizeof(T);
+        for (; i + k <= n; i += k) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n - i - k));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), reverse_block<sizeof(T)>(v));
+        }
+    }
+#endif
+    for (; i < n; ++i) dst[i] = src[n - 1 - i];
 }
 
+// Невласницький перегляд частини рядка; дійсний, поки джерело живе і не змінюється
 template <typename T>
-String<T> operator*(int times, const String<T>& s) {
-    return s * times;
-}
+class StringView {
+    const T* ptr = nullptr;
+    size_t length = 0;
 
-// Порівняльні оператори
+public:
+    static constexpr size_t npos = size_t(-1);
+
+    StringView() = default;
+    StringView(const T* begin, size_t count) : ptr(begin), length(count) {}
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    const T& operator[](size_t index) const {
+        if (index >= length) throw OutOfRangeException(index);
+        return ptr[index];
+    }
+
+    const T* begin() const { return ptr; }
+    const T* end() const { return ptr + length; }
+
+    StringView substr(size_t start, size_t len) const {
+        if (start > length) throw OutOfRangeException(start);
+        return StringView(ptr + start, std::min(len, length - start));
+    }
+};
 
 template <typename T>
-bool operator==(const String<T>& a, const String<T>& b) {
-    if (a.length != b.length) return false;
-    for (size_t i = 0; i < a.length; ++i)
-        if (a.data[i] != b.data[i]) return false;
-    return true;
+bool operator==(const StringView<T>& a, const StringView<T>& b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
 }
 
 template <typename T>
-bool operator!=(const String<T>& a, const String<T>& b) {
+bool operator!=(const StringView<T>& a, const StringView<T>& b) {
     return !(a == b);
 }
 
-template <typename T>
-bool operator<(const String<T>& a, const String<T>& b) {
-    size_t min_len = std::min(a.length, b.length);
-    for (size_t i = 0; i < min_len; ++i) {
-        if (a.data[i] < b.data[i]) return true;
-        if (a.data[i] > b.data[i]) return false;
-    }
-    return a.length < b.length;
+inline std::ostream& operator<<(std::ostream& os, const StringView<char>& view) {
+    return os.write(view.begin(), std::streamsize(view.size()));
 }
 
+// Спостерігач за змінами String<T>; підключається через String::attach.
+// Копії рядка спостерігачів не успадковують; знищення рядка лише від'єднує їх.
 template <typename T>
-bool operator>(const String<T>& a, const String<T>& b) {
-    return b < a;
-}
+class String;
 
 template <typename T>
-bool operator<=(const String<T>& a, const String<T>& b) {
-    return !(a > b);
-}
+class StringObserver {
+    friend class String<T>;
+    String<T>* subject = nullptr;
+    StringObserver* nextObserver = nullptr;
 
-template <typename T>
-bool operator>=(const String<T>& a, const String<T>& b) {
-    return !(a < b);
-}
+public:
+    StringObserver() = default;
+    StringObserver(const StringObserver&) = delete;
+    StringObserver& operator=(const StringObserver&) = delete;
+    virtual ~StringObserver();
 
-// Приклад: перетворювач для зміни символів на верхній регістр
-struct ToUpperChar : Transformer<char> {
-    char operator()(const char& c) const override {
-        return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    // У кінець дописано added елементів; data/length — уже новий стан
+    virtual void on_append(const T* data, size_t length, size_t added) = 0;
+    // Елементи [pos, pos + count) змінено
+    virtual void on_modify(const T* data, size_t length, size_t pos, size_t count) {
+        (void)data; (void)length; (void)pos; (void)count;
     }
+    // Вміст замінено повністю (присвоєння, очищення, вкорочення). Викликається й з noexcept-переміщень
+    // рядка, тому сам не кидає винятків
+    virtual void on_reset(const T* data, size_t length) noexcept { (void)data; (void)length; }
+
+    String<T>* source() const { return subject; }
+};
+
+// Власник чужого буфера, прийнятого String без копіювання; деструктор звільняє буфер
+struct StringBufferOwner {
+    virtual ~StringBufferOwner() = default;
+};
+
+// Буфер, звільнений із String: отримувач викликає deleter(data), коли дані більше не потрібні
+template <typename T>
+struct ReleasedBuffer {
+    T* data = nullptr;
+    size_t length = 0;
+    size_t capacity = 0;
+    std::function<void(T*)> deleter;
+};
+
+// Клас String<T> 
+template <typename T>
+class String {
+    T* data = nullptr;
+    size_t length = 0;
+    size_t allocated = 0;
+    StringObserver<T>* observers = nullptr;
+    // Ненульовий, якщо data належить прийнятому буферу, а не StringMemory
+    StringBufferOwner* owner = nullptr;
+
+    // Прості типи йдуть через StringMemory, решта — через new[]/delete[]
+    static constexpr bool kRawStorage = std::is_trivially_copyable<T>::value;
+
+public:
+    static constexpr size_t npos = size_t(-1);
+
+private:
+
+    // Виділення буфера щонайменше на count елементів; count стає фактичною місткістю.
+    // Місткість резервується в MemoryBudget до виділення
+    static T* allocate(size_t& count) {
+        if (count > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+        if constexpr (kRawStorage) {
+            size_t bytes = StringMemory::round_capacity(count * sizeof(T));
+            count = bytes / sizeof(T);
+            MemoryBudget::charge(count * sizeof(T));
+            try {
+                return static_cast<T*>(StringMemory::allocate(bytes));
+            } catch (...) {
+                MemoryBudget::release(count * sizeof(T));
+                throw;
+            }
+        } else {
+            if (!count) return nullptr;
+            MemoryBudget::charge(count * sizeof(T));
+            try {
+                return new T[count];
+            } catch (...) {
+                MemoryBudget::release(count * sizeof(T));
+                throw;
+            }
+        }
+    }
+
+    static void deallocate(T* p, size_t count) {
+        if (!p) return;
+        MemoryBudget::release(count * sizeof(T));
+        if constexpr (kRawStorage) StringMemory::deallocate(p, count * sizeof(T));
+        else delete[] p;
+    }
+
+    void free_storage() {
+        if (owner) {
+            delete owner;
+            owner = nullptr;
+        } else {
+            deallocate(data, allocated);
+        }
+    }
+
+    void release_buffer() {
+        free_storage();
+        data = nullptr;
+        length = 0;
+        allocated = 0;
+    }
+
+    // Геометричний ріст місткості щонайменше до required
+    void grow(size_t required) {
+        if (required <= allocated) return;
+        size_t newCap = std::max(required, allocated + allocated / 2);
+        if (owner) {
+            // Прийнятий буфер не розширюється на місці: переносимо вміст у власний
+            T* newData = allocate(newCap);
+            for (size_t i = 0; i < length; ++i) newData[i] = data[i];
+            free_storage();
+            data = newData;
+            allocated = newCap;
+        } else if constexpr (kRawStorage) {
+            if (newCap > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+            size_t bytes = StringMemory::round_capacity(newCap * sizeof(T));
+            size_t added = (bytes / sizeof(T) - allocated) * sizeof(T);
+            MemoryBudget::charge(added);
+            try {
+                data = static_cast<T*>(StringMemory::reallocate(data, allocated * sizeof(T), bytes, length * sizeof(T)));
+            } catch (...) {
+                MemoryBudget::release(added);
+                throw;
+            }
+            allocated = bytes / sizeof(T);
+        } else {
+            T* newData = allocate(newCap);
+            for (size_t i = 0; i < length; ++i) newData[i] = data[i];
+            deallocate(data, allocated);
+            data = newData;
+            allocated = newCap;
+        }
+    }
+
+    void copy_from(const T* source, size_t len) {
+        size_t cap = len;
+        data = allocate(cap);
+        allocated = cap;
+        if constexpr (kRawStorage) {
+            if (len) std::memcpy(data, source, len * sizeof(T));
+        } else {
+            for (size_t i = 0; i < len; ++i) data[i] = source[i];
+        }
+        length = len;
+    }
+
+    // Буфер на len елементів без ініціалізації вмісту
+    void allocate_exact(size_t len) {
+        size_t cap = len;
+        data = allocate(cap);
+        allocated = cap;
+        length = len;
+    }
+
+    template <typename Deleter>
+    struct DeleterOwner : StringBufferOwner {
+        T* buffer;
+        Deleter deleter;
+        DeleterOwner(T* b, Deleter d) : buffer(b), deleter(std::move(d)) {}
+        ~DeleterOwner() override { deleter(buffer); }
+    };
+
+    template <typename Container>
+    struct ContainerOwner : StringBufferOwner {
+        Container container;
+        explicit ContainerOwner(Container&& c) : container(std::move(c)) {}
+    };
+
+    template <typename Container>
+    void adopt_container(Container&& c) {
+        size_t len = c.size();
+        if (!c.capacity()) return;
+        auto* holder = new ContainerOwner<Container>(std::move(c));
+        holder->container.resize(holder->container.capacity());
+        data = holder->container.data();
+        length = len;
+        allocated = holder->container.size();
+        owner = holder;
+    }
+
+    template <typename Container>
+    Container release_container() {
+        if (auto* holder = dynamic_cast<ContainerOwner<Container>*>(owner)) {
+            holder->container.resize(length);
+            Container out(std::move(holder->container));
+            release_buffer();
+            notify_reset();
+            return out;
+        }
+        Container out(data, data + length);
+        clear();
+        return out;
+    }
+
+    // Сповіщення спостерігачів (наступний береться заздалегідь: обробник може від'єднатися)
+    void notify_append(size_t added) {
+        for (StringObserver<T>* o = observers; o;) {
+            StringObserver<T>* next = o->nextObserver;
+            o->on_append(data, length, added);
+            o = next;
+        }
+    }
+
+    void notify_modify(size_t pos, size_t count) {
+        for (StringObserver<T>* o = observers; o;) {
+            StringObserver<T>* next = o->nextObserver;
+            o->on_modify(data, length, pos, count);
+            o = next;
+        }
+    }
+
+    void notify_reset() noexcept {
+        for (StringObserver<T>* o = observers; o;) {
+            StringObserver<T>* next = o->nextObserver;
+            o->on_reset(data, length);
+            o = next;
+        }
+    }
+
+public:
+    // Конструктори
+    String() = default;
+
+    String(const String& other) {
+        copy_from(other.data, other.length);
+    }
+
+    String(String&& other) noexcept
+        : data(other.data), length(other.length), allocated(other.allocated), owner(other.owner) {
+        other.data = nullptr;
+        other.length = 0;
+        other.allocated = 0;
+        other.owner = nullptr;
+        other.notify_reset();
+    }
+
+    // Прийняття вмісту std::basic_string / std::vector без копіювання: контейнер переноситься в купу
+    // і розтягується до своєї місткості, тож дописування в межах місткості теж не копіює
+    template <typename Traits, typename Alloc>
+    explicit String(std::basic_string<T, Traits, Alloc>&& s) { adopt_container(std::move(s)); }
+
+    template <typename Alloc>
+    explicit String(std::vector<T, Alloc>&& v) { adopt_container(std::move(v)); }
+
+    String(size_t count, const T& ch) {
+        allocate_exact(count);
+        for (size_t i = 0; i < count; ++i) data[i] = ch;
+    }
+
+    String(const T* cstr) {
+        if constexpr (std::is_same<T, char>::value) {
+            length = std::strlen(cstr);
+        } else {
+            length = 0;
+            while (!(cstr[length] == T())) ++length;
+        }
+        copy_from(cstr, length);
+    }
+
+    String(const T* begin, const T* end) {
+        if (begin > end) throw InvalidRangeException();
+        size_t len = end - begin;
+        copy_from(begin, len);
+    }
+
+    explicit String(StringView<T> view) {
+        copy_from(view.begin(), view.size());
+    }
+
+    template <typename U>
+    String(const String<U>& other) {
+        allocate_exact(other.size());
+        for (size_t i = 0; i < length; ++i) data[i] = static_cast<T>(other[i]);
+    }
+
+    ~String() {
+        while (observers) detach(*observers);
+        free_storage();
+    }
+
+    // Присвоєння
+    String& operator=(const String& other) {
+        if (this != &other) {
+            release_buffer();
+            copy_from(other.data, other.length);
+            notify_reset();
+        }
+        return *this;
+    }
+
+    String& operator=(String&& other) noexcept {
+        if (this != &other) {
+            free_storage();
+            data = other.data;
+            length = other.length;
+            allocated = other.allocated;
+            owner = other.owner;
+            other.data = nullptr;
+            other.length = 0;
+            other.allocated = 0;
+            other.owner = nullptr;
+            notify_reset();
+            other.notify_reset();
+        }
+        return *this;
+    }
+
+    // Підключення спостерігача (від'єднується від попереднього рядка) та від'єднання
+    void attach(StringObserver<T>& observer) {
+        if (observer.subject == this) return;
+        if (observer.subject) observer.subject->detach(observer);
+        observer.subject = this;
+        observer.nextObserver = observers;
+        observers = &observer;
+    }
+
+    void detach(StringObserver<T>& observer) {
+        for (StringObserver<T>** p = &observers; *p; p = &(*p)->nextObserver) {
+            if (*p == &observer) {
+                *p = observer.nextObserver;
+                break;
+            }
+        }
+        observer.subject = nullptr;
+        observer.nextObserver = nullptr;
+    }
+
+    // Прийняття чужого буфера: length елементів уже записано, capacity — доступна місткість;
+    // deleter(buffer) буде викликано, коли рядок відмовиться від буфера
+    template <typename Deleter>
+    static String adopt(T* buffer, size_t length, size_t capacity, Deleter deleter) {
+        if (capacity < length) {
+            deleter(buffer);
+            throw InvalidRangeException();
+        }
+        String result;
+        try {
+            result.owner = new DeleterOwner<Deleter>(buffer, deleter);
+        } catch (...) {
+            deleter(buffer);
+            throw;
+        }
+        result.data = buffer;
+        result.length = length;
+        result.allocated = capacity;
+        return result;
+    }
+
+    template <typename Deleter>
+    static String adopt(T* buffer, size_t length, Deleter deleter) {
+        return adopt(buffer, length, length, deleter);
+    }
+
+    // Віддає буфер без копіювання; рядок стає порожнім
+    ReleasedBuffer<T> release() {
+        ReleasedBuffer<T> out;
+        out.data = data;
+        out.length = length;
+        out.capacity = allocated;
+        if (owner) {
+            StringBufferOwner* o = owner;
+            out.deleter = [o](T*) { delete o; };
+        } else {
+            size_t cap = allocated;
+            out.deleter = [cap](T* p) { deallocate(p, cap); };
+        }
+        data = nullptr;
+        length = 0;
+        allocated = 0;
+        owner = nullptr;
+        notify_reset();
+        return out;
+    }
+
+    // Перетворення на std::basic_string / std::vector: без копіювання, якщо буфер прийнято
+    // з контейнера того ж типу, інакше копіюванням; рядок стає порожнім
+    template <typename Traits = std::char_traits<T>, typename Alloc = std::allocator<T>>
+    std::basic_string<T, Traits, Alloc> release_string() {
+        return release_container<std::basic_string<T, Traits, Alloc>>();
+    }
+
+    template <typename Alloc = std::allocator<T>>
+    std::vector<T, Alloc> release_vector() {
+        return release_container<std::vector<T, Alloc>>();
+    }
+
+    // Методи доступу
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    size_t capacity() const { return allocated; }
+    void clear() {
+        release_buffer();
+        notify_reset();
+    }
+
+    // Резервування місця під count елементів без зміни вмісту
+    void reserve(size_t count) { grow(count); }
+
+    // Елемент, що повертає неконстантний operator[]: читання спостерігачів не сповіщає,
+    // присвоєння виконується через set і сповіщає
+    class Reference {
+    public:
+        Reference(const Reference&) = default;
+
+        Reference& operator=(const T& value) {
+            owner->set(index, value);
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other) { return *this = static_cast<const T&>(other); }
+
+        operator const T&() const { return owner->data[index]; }
+
+    private:
+        friend class String;
+
+        Reference(String* owner, size_t index) : owner(owner), index(index) {}
+
+        String* owner;
+        size_t index;
+    };
+
+    // Запис через operator[] сповіщає спостерігачів (через set); запис через begin() — ні
+    Reference operator[](size_t index) {
+        if (index >= length) throw OutOfRangeException(index);
+        return Reference(this, index);
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= length) throw OutOfRangeException(index);
+        return data[index];
+    }
+
+    // Запис елемента зі сповіщенням спостерігачів
+    void set(size_t index, const T& value) {
+        if (index >= length) throw OutOfRangeException(index);
+        data[index] = value;
+        if (observers) notify_modify(index, 1);
+    }
+
+    String substr(size_t start, size_t len) const {
+        if (start > length) throw OutOfRangeException(start);
+        size_t actualLen = std::min(len, length - start);
+        return String(data + start, data + start + actualLen);
+    }
+
+    // Розворот на місці та розвернута копія (поелементно; для UTF-8 див. utf8_reversed)
+    void reverse() {
+        reverse_elements(data, length);
+        if (observers) notify_modify(0, length);
+    }
+
+    String reversed() const {
+        String result;
+        result.allocate_exact(length);
+        reverse_copy_elements(data, length, result.data);
+        return result;
+    }
+
+    // Оператори конкатенації
+    String operator+(const String& other) const {
+        String result;
+        result.allocate_exact(length + other.length);
+        for (size_t i = 0; i < length; ++i) result.data[i] = data[i];
+        for (size_t i = 0; i < other.length; ++i) result.data[length + i] = other.data[i];
+        return result;
+    }
+
+    String& operator+=(const T& ch) {
+        if (length == allocated) grow(length + 1);
+        data[length++] = ch;
+        if (observers) notify_append(1);
+        return *this;
+    }
+
+    String& operator+=(const String& other) { return append(other.data, other.length); }
+
+    // Трансформації; після скасування через token частина елементів уже змінена
+    void apply(const Transformer<T>& transformer, const CancellationToken* token = nullptr) {
+        modify([&transformer](const T& c) { return transformer(c); }, token);
+    }
+
+    template <typename Trans>
+    void modify(const Trans& transformer, const CancellationToken* token = nullptr) {
+        modify_range(0, length, transformer, token);
+    }
+
+    // Трансформація лише елементів [pos, pos + count)
+    template <typename Trans>
+    void modify_range(size_t pos, size_t count, const Trans& transformer, const CancellationToken* token = nullptr) {
+        if (pos > length) throw OutOfRangeException(pos);
+        count = std::min(count, length - pos);
+        T* base = data + pos;
+        try {
+            for_each_chunk(count, token, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) base[i] = transformer(base[i]);
+            });
+        } catch (...) {
+            if (observers) notify_modify(pos, count);
+            throw;
+        }
+        if (observers) notify_modify(pos, count);
+    }
+
+    template <typename Trans>
+    String transformed(const Trans& transformer, const CancellationToken* token = nullptr) const {
+        String result;
+        result.allocate_exact(length);
+        for_each_chunk(length, token, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) result.data[i] = transformer(data[i]);
+        });
+        return result;
+    }
+
+    String transformed(const Transformer<T>& transformer, const CancellationToken* token = nullptr) const {
+        return transformed([&transformer](const T& c) { return transformer(c); }, token);
+    }
+
+    // Додавання n елементів у кінець (джерело може лежати в цьому ж рядку)
+    String& append(const T* src, size_t n) {
+        if (!n) return *this;
+        if (length + n > allocated) {
+            bool inside = src >= data && src < data + length;
+            size_t offset = inside ? size_t(src - data) : 0;
+            grow(length + n);
+            if (inside) src = data + offset;
+        }
+        for (size_t i = 0; i < n; ++i) data[length + i] = src[i];
+        length += n;
+        if (observers) notify_append(n);
+        return *this;
+    }
+
+    // Зміна довжини; нові елементи заповнюються fill
+    void resize(size_t count, const T& fill = T()) {
+        grow(count);
+        for (size_t i = length; i < count; ++i) data[i] = fill;
+        size_t old = length;
+        length = count;
+        if (!observers || count == old) return;
+        if (count > old) notify_append(count - old);
+        else notify_reset();
+    }
+
+    // Зміна довжини без заповнення нових елементів (для простих T їхній вміст невизначений);
+    // повертає вказівник на буфер для подальшого запису. Спостерігачів не сповіщає
+    T* resize_uninitialized(size_t count) {
+        grow(count);
+        length = count;
+        return data;
+    }
+
+    // Ітерація по елементах без перевірки меж (запис через begin() спостерігачів не сповіщає)
+    T* begin() { return data; }
+    T* end() { return data + length; }
+    const T* begin() const { return data; }
+    const T* end() const { return data + length; }
+
+    StringView<T> view() const { return StringView<T>(data, length); }
+
+    // Доступ до data (для зовнішніх операторів)
+    const T* c_str() const { return data ? data : ""; }
+
+    // Друзі для операторів
+    template <typename U>
+    friend String<U> operator+(const String<U>& s, const U& ch);
+
+    template <typename U>
+    friend String<U> operator+(const U& ch, const String<U>& s);
+
+    template <typename U>
+    friend String<U> operator*(const String<U>& s, int times);
+
+    template <typename U>
+    friend String<U> operator*(int times, const String<U>& s);
+
+    template <typename U>
+    friend bool operator==(const String<U>& a, const String<U>& b);
+
+    template <typename U>
+    friend bool operator!=(const String<U>& a, const String<U>& b);
+
+    template <typename U>
+    friend bool operator<(const String<U>& a, const String<U>& b);
+
+    template <typename U>
+    friend bool operator>(const String<U>& a, const String<U>& b);
+
+    template <typename U>
+    friend bool operator<=(const String<U>& a, const String<U>& b);
+
+    template <typename U>
+    friend bool operator>=(const String<U>& a, const String<U>& b);
+
+    // Оператори вводу/виводу оголошуємо друзями (тільки для char)
+    friend std::ostream& operator<<(std::ostream& os, const String<char>& str);
+    friend std::istream& operator>>(std::istream& is, String<char>& str);
+};
+
+template <typename T>
+StringObserver<T>::~StringObserver() {
+    if (subject) subject->detach(*this);
+}
+
+// Реалізація друкованих і ввідних операторів поза класом
+
+std::ostream& operator<<(std::ostream& os, const String<char>& str) {
+    return os.write(str.begin(), std::streamsize(str.size()));
+}
+
+std::istream& operator>>(std::istream& is, String<char>& str) {
+    std::string temp;
+    is >> temp;
+    str = String<char>(std::move(temp));
+    return is;
+}
+
+// Оператори конкатенації та повторення
+
+template <typename T>
+String<T> operator+(const String<T>& s, const T& ch) {
+    String<T> result = s;
+    result += ch;
+    return result;
+}
+
+template <typename T>
+String<T> operator+(const T& ch, const String<T>& s) {
+    String<T> result(1, ch);
+    return result + s;
+}
+
+// Повторення з можливістю скасування: результат заповнюється блоками, у кожному — цілі відрізки копій s
+template <typename T>
+String<T> repeat(const String<T>& s, int times, const CancellationToken* token = nullptr) {
+    if (times <= 0) return String<T>();
+    size_t n = s.size();
+    if (n && size_t(times) > SIZE_MAX / n) throw std::bad_alloc();
+    String<T> result;
+    T* out = result.resize_uninitialized(n * size_t(times));
+    const T* src = s.begin();
+    for_each_chunk(n * size_t(times), token, [&](size_t begin, size_t end) {
+        for (size_t pos = begin; pos < end;) {
+            size_t offset = pos % n;
+            size_t len = std::min(n - offset, end - pos);
+            std::copy(src + offset, src + offset + len, out + pos);
+            pos += len;
+        }
+    });
+    return result;
+}
+
+template <typename T>
+String<T> operator*(const String<T>& s, int times) {
+    return repeat(s, times);
+}
+
+template <typename T>
+String<T> operator*(int times, const String<T>& s) {
+    return s * times;
+}
+
+// Порівняльні оператори
+
+template <typename T>
+bool operator==(const String<T>& a, const String<T>& b) {
+    if (a.length != b.length) return false;
+    for (size_t i = 0; i < a.length; ++i)
+        if (a.data[i] != b.data[i]) return false;
+    return true;
+}
+
+template <typename T>
+bool operator!=(const String<T>& a, const String<T>& b) {
+    return !(a == b);
+}
+
+template <typename T>
+bool operator<(const String<T>& a, const String<T>& b) {
+    size_t min_len = std::min(a.length, b.length);
+    for (size_t i = 0; i < min_len; ++i) {
+        if (a.data[i] < b.data[i]) return true;
+        if (a.data[i] > b.data[i]) return false;
+    }
+    return a.length < b.length;
+}
+
+template <typename T>
+bool operator>(const String<T>& a, const String<T>& b) {
+    return b < a;
+}
+
+template <typename T>
+bool operator<=(const String<T>& a, const String<T>& b) {
+    return !(a > b);
+}
+
+template <typename T>
+bool operator>=(const String<T>& a, const String<T>& b) {
+    return !(a < b);
+}
+
+// Приклад: перетворювач для зміни символів на верхній регістр
+struct ToUpperChar : Transformer<char> {
+    char operator()(const char& c) const override {
+        return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+};
+
+// UTF-8
+// Некоректна послідовність декодується як kInvalidCodePoint довжиною 1 байт
+constexpr char32_t kInvalidCodePoint = 0xFFFFFFFF;
+
+inline size_t utf8_decode(const char* s, size_t n, char32_t& cp) {
+    const unsigned char* u = reinterpret_cast<const unsigned char*>(s);
+    unsigned char c = u[0];
+    cp = kInvalidCodePoint;
+    if (c < 0x80) {
+        cp = c;
+        return 1;
+    }
+    size_t len;
+    char32_t min;
+    if (c >= 0xC2 && c <= 0xDF) { len = 2; min = 0x80; cp = c & 0x1F; }
+    else if (c >= 0xE0 && c <= 0xEF) { len = 3; min = 0x800; cp = c & 0x0F; }
+    else if (c >= 0xF0 && c <= 0xF4) { len = 4; min = 0x10000; cp = c & 0x07; }
+    else { cp = kInvalidCodePoint; return 1; }
+    if (len > n) { cp = kInvalidCodePoint; return 1; }
+    for (size_t i = 1; i < len; ++i) {
+        if ((u[i] & 0xC0) != 0x80) { cp = kInvalidCodePoint; return 1; }
+        cp = (cp << 6) | (u[i] & 0x3F);
+    }
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        cp = kInvalidCodePoint;
+        return 1;
+    }
+    return len;
+}
+
+inline size_t utf8_encode(char32_t cp, char* out) {
+    if (cp < 0x80) {
+        out[0] = char(cp);
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = char(0xC0 | (cp >> 6));
+        out[1] = char(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = char(0xE0 | (cp >> 12));
+        out[1] = char(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = char(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = char(0xF0 | (cp >> 18));
+    out[1] = char(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = char(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = char(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+inline size_t utf8_encoded_length(char32_t cp) {
+    return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+}
+
+// Потоковий ввід/вивід String<T> для char16_t, char32_t і wchar_t: у потоці — UTF-8.
+// 16-бітні одиниці трактуються як UTF-16 (з сурогатними парами), 32-бітні — як кодові точки;
+// некоректні одиниці та байти замінюються на U+FFFD. ASCII-блоки по 16 одиниць перетворюються в SSE2.
+template <typename T>
+constexpr bool kUtf8Transcodable =
+    std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value || std::is_same<T, wchar_t>::value;
+
+// Одиниці, що вже є байтами UTF-8 (char, char8_t): копіюються без перекодування
+template <typename T>
+constexpr bool kUtf8CodeUnit = std::is_same<T, char>::value
+#ifdef __cpp_char8_t
+                               || std::is_same<T, char8_t>::value
+#endif
+    ;
+
+// Довжина ASCII-префікса src, одразу звуженого в dst
+template <typename T>
+size_t narrow_ascii(const T* src, size_t n, char* dst) {
+    size_t i = 0;
+#ifdef STRING_HAS_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    if constexpr (sizeof(T) == 2) {
+        const __m128i high = _mm_set1_epi16(short(0xFF80));
+        for (; i + 16 <= n; i += 16) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), high), zero)) != 0xFFFF) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(a, b));
+        }
+    } else if constexpr (sizeof(T) == 4) {
+        const __m128i high = _mm_set1_epi32(int(0xFFFFFF80));
+        for (; i + 16 <= n; i += 16) {
+            const __m128i* s = reinterpret_cast<const __m128i*>(src + i);
+            __m128i a = _mm_loadu_si128(s), b = _mm_loadu_si128(s + 1);
+            __m128i c = _mm_loadu_si128(s + 2), d = _mm_loadu_si128(s + 3);
+            __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, high), zero)) != 0xFFFF) break;
+            __m128i lo = _mm_packs_epi32(a, b), hi = _mm_packs_epi32(c, d);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+        }
+    }
+#endif
+    for (; i < n && uint32_t(src[i]) < 0x80; ++i) dst[i] = char(src[i]);
+    return i;
+}
+
+// Кодування n одиниць у UTF-8; dst має вміщати 4 * n байтів. Повертає кількість байтів
+template <typename T>
+size_t utf8_encode_units(const T* src, size_t n, char* dst) {
+    size_t i = 0, w = 0;
+    while (i < n) {
+        size_t ascii = narrow_ascii(src + i, n - i, dst + w);
+        i += ascii;
+        w += ascii;
+        if (i == n) break;
+        char32_t cp = char32_t(src[i++]);
+        if constexpr (sizeof(T) == 2) {
+            cp &= 0xFFFF;
+            if (cp >= 0xD800 && cp < 0xDC00 && i < n && (char32_t(src[i]) & 0xFC00) == 0xDC00)
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (char32_t(src[i++]) & 0x3FF);
+        }
+        if ((cp >= 0xD800 && cp < 0xE000) || cp > 0x10FFFF) cp = 0xFFFD;
+        w += utf8_encode(cp, dst + w);
+    }
+    return w;
+}
+
+// Точна довжина результату utf8_encode_units у байтах
+template <typename T>
+size_t utf8_units_length(const T* src, size_t n) {
+    size_t i = 0, total = 0;
+    while (i < n) {
+        char32_t cp = char32_t(src[i++]);
+        if constexpr (sizeof(T) == 2) {
+            cp &= 0xFFFF;
+            if (cp >= 0xD800 && cp < 0xDC00 && i < n && (char32_t(src[i]) & 0xFC00) == 0xDC00) {
+                ++i;
+                total += 4;
+                continue;
+            }
+        }
+        if ((cp >= 0xD800 && cp < 0xE000) || cp > 0x10FFFF) cp = 0xFFFD;
+        total += utf8_encoded_length(cp);
+    }
+    return total;
+}
+
+// Декодування UTF-8 в одиниці T; dst має вміщати n одиниць. Повертає кількість одиниць
+template <typename T>
+size_t utf8_decode_units(const char* src, size_t n, T* dst) {
+    size_t i = 0, w = 0;
+    while (i < n) {
+#ifdef STRING_HAS_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= n; i += 16, w += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            if (_mm_movemask_epi8(v)) break;
+            __m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+            __m128i* d = reinterpret_cast<__m128i*>(dst + w);
+            if constexpr (sizeof(T) == 2) {
+                _mm_storeu_si128(d, lo);
+                _mm_storeu_si128(d + 1, hi);
+            } else {
+                _mm_storeu_si128(d, _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128(d + 2, _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128(d + 3, _mm_unpackhi_epi16(hi, zero));
+            }
+        }
+        if (i == n) break;
+#endif
+        if (static_cast<unsigned char>(src[i]) < 0x80) {
+            dst[w++] = T(src[i++]);
+            continue;
+        }
+        char32_t cp;
+        i += utf8_decode(src + i, n - i, cp);
+        if (cp == kInvalidCodePoint) cp = 0xFFFD;
+        if constexpr (sizeof(T) == 2) {
+            if (cp >= 0x10000) {
+                cp -= 0x10000;
+                dst[w++] = T(0xD800 + (cp >> 10));
+                dst[w++] = T(0xDC00 + (cp & 0x3FF));
+                continue;
+            }
+        }
+        dst[w++] = T(cp);
+    }
+    return w;
+}
+
+template <typename T, typename = std::enable_if_t<kUtf8Transcodable<T>>>
+std::ostream& operator<<(std::ostream& os, StringView<T> s) {
+    constexpr size_t kBlock = 1024;
+    char buf[4 * (kBlock + 1)];
+    const T* p = s.begin();
+    size_t n = s.size();
+    for (size_t i = 0; i < n;) {
+        size_t take = std::min(kBlock, n - i);
+        // Сурогатна пара не розривається межею блоку
+        if (sizeof(T) == 2 && take < n - i && (char32_t(p[i + take - 1]) & 0xFC00) == 0xD800) ++take;
+        os.write(buf, std::streamsize(utf8_encode_units(p + i, take, buf)));
+        i += take;
+    }
+    return os;
+}
+
+template <typename T, typename = std::enable_if_t<kUtf8Transcodable<T>>>
+std::ostream& operator<<(std::ostream& os, const String<T>& str) {
+    return os << str.view();
+}
+
+// Читає слово до пробілу, як і версія для char
+template <typename T, typename = std::enable_if_t<kUtf8Transcodable<T>>>
+std::istream& operator>>(std::istream& is, String<T>& str) {
+    std::string temp;
+    is >> temp;
+    String<T> result;
+    T* out = result.resize_uninitialized(temp.size());
+    result.resize(utf8_decode_units(temp.data(), temp.size(), out));
+    str = std::move(result);
+    return is;
+}
+
+// Дворівнева таблиця властивостей кодових точок
+// Значення задаються через set, finish будує таблицю для читання (однакові блоки по 128 кодових точок
+// зберігаються один раз); після нових set потрібен повторний finish.
+template <typename V>
+class CodePointTable {
+public:
+    static constexpr size_t kBlockBits = 7;
+    static constexpr size_t kBlockSize = size_t(1) << kBlockBits;
+
+    void set(char32_t cp, V value) {
+        auto it = pending.find(cp >> kBlockBits);
+        if (it == pending.end()) it = pending.emplace(cp >> kBlockBits, std::array<V, kBlockSize>{}).first;
+        it->second[cp & (kBlockSize - 1)] = value;
+    }
+
+    V get_pending(char32_t cp) const {
+        auto it = pending.find(cp >> kBlockBits);
+        return it == pending.end() ? V() : it->second[cp & (kBlockSize - 1)];
+    }
+
+    void finish() {
+        std::map<std::array<V, kBlockSize>, uint16_t> unique;
+        std::array<V, kBlockSize> zero{};
+        unique.emplace(zero, 0);
+        stage2.assign(zero.begin(), zero.end());
+        stage1.assign(0x110000 >> kBlockBits, 0);
+        for (const auto& b : pending) {
+            auto it = unique.find(b.second);
+            if (it == unique.end()) {
+                it = unique.emplace(b.second, uint16_t(unique.size())).first;
+                stage2.insert(stage2.end(), b.second.begin(), b.second.end());
+            }
+            stage1[b.first] = it->second;
+        }
+    }
+
+    V operator[](char32_t cp) const {
+        if (cp > 0x10FFFF) return V();
+        return stage2[(size_t(stage1[cp >> kBlockBits]) << kBlockBits) | (cp & (kBlockSize - 1))];
+    }
+
+private:
+    std::map<char32_t, std::array<V, kBlockSize>> pending;
+    std::vector<uint16_t> stage1;
+    std::vector<V> stage2;
+};
+
+// Регістр Unicode
+// Дані згенеровано з Unicode 14 (UnicodeData + SpecialCasing без умовних правил, CaseFolding C+F).
+// Діапазони розгортаються при першому використанні у таблиці дельт CodePointTable.
+enum class CaseMapping { Upper, Lower, Fold };
+
+struct CaseRange {
+    char32_t first;
+    uint16_t count;
+    uint8_t stride;
+    int32_t delta;
+};
+
+struct CaseSpecial {
+    char32_t cp;
+    char32_t to[3];
+};
+
+static const CaseRange kUpperRanges[] = {
+    {0x0061, 26, 1, -32}, {0x00B5, 1, 1, 743}, {0x00E0, 23, 1, -32}, {0x00F8, 7, 1, -32},
+    {0x00FF, 1, 1, 121}, {0x0101, 24, 2, -1}, {0x0131, 1, 1, -232}, {0x0133, 3, 2, -1},
+    {0x013A, 8, 2, -1}, {0x014B, 23, 2, -1}, {0x017A, 3, 2, -1}, {0x017F, 1, 1, -300},
+    {0x0180, 1, 1, 195}, {0x0183, 2, 2, -1}, {0x0188, 1, 1, -1}, {0x018C, 1, 1, -1},
+    {0x0192, 1, 1, -1}, {0x0195, 1, 1, 97}, {0x0199, 1, 1, -1}, {0x019A, 1, 1, 163},
+    {0x019E, 1, 1, 130}, {0x01A1, 3, 2, -1}, {0x01A8, 1, 1, -1}, {0x01AD, 1, 1, -1},
+    {0x01B0, 1, 1, -1}, {0x01B4, 2, 2, -1}, {0x01B9, 1, 1, -1}, {0x01BD, 1, 1, -1},
+    {0x01BF, 1, 1, 56}, {0x01C5, 1, 1, -1}, {0x01C6, 1, 1, -2}, {0x01C8, 1, 1, -1},
+    {0x01C9, 1, 1, -2}, {0x01CB, 1, 1, -1}, {0x01CC, 1, 1, -2}, {0x01CE, 8, 2, -1},
+    {0x01DD, 1, 1, -79}, {0x01DF, 9, 2, -1}, {0x01F2, 1, 1, -1}, {0x01F3, 1, 1, -2},
+    {0x01F5, 1, 1, -1}, {0x01F9, 20, 2, -1}, {0x0223, 9, 2, -1}, {0x023C, 1, 1, -1},
+    {0x023F, 2, 1, 10815}, {0x0242, 1, 1, -1}, {0x0247, 5, 2, -1}, {0x0250, 1, 1, 10783},
+    {0x0251, 1, 1, 10780}, {0x0252, 1, 1, 10782}, {0x0253, 1, 1, -210}, {0x0254, 1, 1, -206},
+    {0x0256, 2, 1, -205}, {0x0259, 1, 1, -202}, {0x025B, 1, 1, -203}, {0x025C, 1, 1, 42319},
+    {0x0260, 1, 1, -205}, {0x0261, 1, 1, 42315}, {0x0263, 1, 1, -207}, {0x0265, 1, 1, 42280},
+    {0x0266, 1, 1, 42308}, {0x0268, 1, 1, -209}, {0x0269, 1, 1, -211}, {0x026A, 1, 1, 42308},
+    {0x026B, 1, 1, 10743}, {0x026C, 1, 1, 42305}, {0x026F, 1, 1, -211}, {0x0271, 1, 1, 10749},
+    {0x0272, 1, 1, -213}, {0x0275, 1, 1, -214}, {0x027D, 1, 1, 10727}, {0x0280, 1, 1, -218},
+    {0x0282, 1, 1, 42307}, {0x0283, 1, 1, -218}, {0x0287, 1, 1, 42282}, {0x0288, 1, 1, -218},
+    {0x0289, 1, 1, -69}, {0x028A, 2, 1, -217}, {0x028C, 1, 1, -71}, {0x0292, 1, 1, -219},
+    {0x029D, 1, 1, 42261}, {0x029E, 1, 1, 42258}, {0x0345, 1, 1, 84}, {0x0371, 2, 2, -1},
+    {0x0377, 1, 1, -1}, {0x037B, 3, 1, 130}, {0x03AC, 1, 1, -38}, {0x03AD, 3, 1, -37},
+    {0x03B1, 17, 1, -32}, {0x03C2, 1, 1, -31}, {0x03C3, 9, 1, -32}, {0x03CC, 1, 1, -64},
+    {0x03CD, 2, 1, -63}, {0x03D0, 1, 1, -62}, {0x03D1, 1, 1, -57}, {0x03D5, 1, 1, -47},
+    {0x03D6, 1, 1, -54}, {0x03D7, 1, 1, -8}, {0x03D9, 12, 2, -1}, {0x03F0, 1, 1, -86},
+    {0x03F1, 1, 1, -80}, {0x03F2, 1, 1, 7}, {0x03F3, 1, 1, -116}, {0x03F5, 1, 1, -96},
+    {0x03F8, 1, 1, -1}, {0x03FB, 1, 1, -1}, {0x0430, 32, 1, -32}, {0x0450, 16, 1, -80},
+    {0x0461, 17, 2, -1}, {0x048B, 27, 2, -1}, {0x04C2, 7, 2, -1}, {0x04CF, 1, 1, -15},
+    {0x04D1, 48, 2, -1}, {0x0561, 38, 1, -48}, {0x10D0, 43, 1, 3008}, {0x10FD, 3, 1, 3008},
+    {0x13F8, 6, 1, -8}, {0x1C80, 1, 1, -6254}, {0x1C81, 1, 1, -6253}, {0x1C82, 1, 1, -6244},
+    {0x1C83, 2, 1, -6242}, {0x1C85, 1, 1, -6243}, {0x1C86, 1, 1, -6236}, {0x1C87, 1, 1, -6181},
+    {0x1C88, 1, 1, 35266}, {0x1D79, 1, 1, 35332}, {0x1D7D, 1, 1, 3814}, {0x1D8E, 1, 1, 35384},
+    {0x1E01, 75, 2, -1}, {0x1E9B, 1, 1, -59}, {0x1EA1, 48, 2, -1}, {0x1F00, 8, 1, 8},
+    {0x1F10, 6, 1, 8}, {0x1F20, 8, 1, 8}, {0x1F30, 8, 1, 8}, {0x1F40, 6, 1, 8},
+    {0x1F51, 4, 2, 8}, {0x1F60, 8, 1, 8}, {0x1F70, 2, 1, 74}, {0x1F72, 4, 1, 86},
+    {0x1F76, 2, 1, 100}, {0x1F78, 2, 1, 128}, {0x1F7A, 2, 1, 112}, {0x1F7C, 2, 1, 126},
+    {0x1FB0, 2, 1, 8}, {0x1FBE, 1, 1, -7205}, {0x1FD0, 2, 1, 8}, {0x1FE0, 2, 1, 8},
+    {0x1FE5, 1, 1, 7}, {0x214E, 1, 1, -28}, {0x2170, 16, 1, -16}, {0x2184, 1, 1, -1},
+    {0x24D0, 26, 1, -26}, {0x2C30, 48, 1, -48}, {0x2C61, 1, 1, -1}, {0x2C65, 1, 1, -10795},
+    {0x2C66, 1, 1, -10792}, {0x2C68, 3, 2, -1}, {0x2C73, 1, 1, -1}, {0x2C76, 1, 1, -1},
+    {0x2C81, 50, 2, -1}, {0x2CEC, 2, 2, -1}, {0x2CF3, 1, 1, -1}, {0x2D00, 38, 1, -7264},
+    {0x2D27, 1, 1, -7264}, {0x2D2D, 1, 1, -7264}, {0xA641, 23, 2, -1}, {0xA681, 14, 2, -1},
+    {0xA723, 7, 2, -1}, {0xA733, 31, 2, -1}, {0xA77A, 2, 2, -1}, {0xA77F, 5, 2, -1},
+    {0xA78C, 1, 1, -1}, {0xA791, 2, 2, -1}, {0xA794, 1, 1, 48}, {0xA797, 10, 2, -1},
+    {0xA7B5, 8, 2, -1}, {0xA7C8, 2, 2, -1}, {0xA7D1, 1, 1, -1}, {0xA7D7, 2, 2, -1},
+    {0xA7F6, 1, 1, -1}, {0xAB53, 1, 1, -928}, {0xAB70, 80, 1, -38864}, {0xFF41, 26, 1, -32},
+    {0x10428, 40, 1, -40}, {0x104D8, 36, 1, -40}, {0x10597, 11, 1, -39}, {0x105A3, 15, 1, -39},
+    {0x105B3, 7, 1, -39}, {0x105BB, 2, 1, -39}, {0x10CC0, 51, 1, -64}, {0x118C0, 32, 1, -32},
+    {0x16E60, 32, 1, -32}, {0x1E922, 34, 1, -34},
+};
+static const CaseRange kLowerRanges[] = {
+    {0x0041, 26, 1, 32}, {0x00C0, 23, 1, 32}, {0x00D8, 7, 1, 32}, {0x0100, 24, 2, 1},
+    {0x0132, 3, 2, 1}, {0x0139, 8, 2, 1}, {0x014A, 23, 2, 1}, {0x0178, 1, 1, -121},
+    {0x0179, 3, 2, 1}, {0x0181, 1, 1, 210}, {0x0182, 2, 2, 1}, {0x0186, 1, 1, 206},
+    {0x0187, 1, 1, 1}, {0x0189, 2, 1, 205}, {0x018B, 1, 1, 1}, {0x018E, 1, 1, 79},
+    {0x018F, 1, 1, 202}, {0x0190, 1, 1, 203}, {0x0191, 1, 1, 1}, {0x0193, 1, 1, 205},
+    {0x0194, 1, 1, 207}, {0x0196, 1, 1, 211}, {0x0197, 1, 1, 209}, {0x0198, 1, 1, 1},
+    {0x019C, 1, 1, 211}, {0x019D, 1, 1, 213}, {0x019F, 1, 1, 214}, {0x01A0, 3, 2, 1},
+    {0x01A6, 1, 1, 218}, {0x01A7, 1, 1, 1}, {0x01A9, 1, 1, 218}, {0x01AC, 1, 1, 1},
+    {0x01AE, 1, 1, 218}, {0x01AF, 1, 1, 1}, {0x01B1, 2, 1, 217}, {0x01B3, 2, 2, 1},
+    {0x01B7, 1, 1, 219}, {0x01B8, 1, 1, 1}, {0x01BC, 1, 1, 1}, {0x01C4, 1, 1, 2},
+    {0x01C5, 1, 1, 1}, {0x01C7, 1, 1, 2}, {0x01C8, 1, 1, 1}, {0x01CA, 1, 1, 2},
+    {0x01CB, 9, 2, 1}, {0x01DE, 9, 2, 1}, {0x01F1, 1, 1, 2}, {0x01F2, 2, 2, 1},
+    {0x01F6, 1, 1, -97}, {0x01F7, 1, 1, -56}, {0x01F8, 20, 2, 1}, {0x0220, 1, 1, -130},
+    {0x0222, 9, 2, 1}, {0x023A, 1, 1, 10795}, {0x023B, 1, 1, 1}, {0x023D, 1, 1, -163},
+    {0x023E, 1, 1, 10792}, {0x0241, 1, 1, 1}, {0x0243, 1, 1, -195}, {0x0244, 1, 1, 69},
+    {0x0245, 1, 1, 71}, {0x0246, 5, 2, 1}, {0x0370, 2, 2, 1}, {0x0376, 1, 1, 1},
+    {0x037F, 1, 1, 116}, {0x0386, 1, 1, 38}, {0x0388, 3, 1, 37}, {0x038C, 1, 1, 64},
+    {0x038E, 2, 1, 63}, {0x0391, 17, 1, 32}, {0x03A3, 9, 1, 32}, {0x03CF, 1, 1, 8},
+    {0x03D8, 12, 2, 1}, {0x03F4, 1, 1, -60}, {0x03F7, 1, 1, 1}, {0x03F9, 1, 1, -7},
+    {0x03FA, 1, 1, 1}, {0x03FD, 3, 1, -130}, {0x0400, 16, 1, 80}, {0x0410, 32, 1, 32},
+    {0x0460, 17, 2, 1}, {0x048A, 27, 2, 1}, {0x04C0, 1, 1, 15}, {0x04C1, 7, 2, 1},
+    {0x04D0, 48, 2, 1}, {0x0531, 38, 1, 48}, {0x10A0, 38, 1, 7264}, {0x10C7, 1, 1, 7264},
+    {0x10CD, 1, 1, 7264}, {0x13A0, 80, 1, 38864}, {0x13F0, 6, 1, 8}, {0x1C90, 43, 1, -3008},
+    {0x1CBD, 3, 1, -3008}, {0x1E00, 75, 2, 1}, {0x1E9E, 1, 1, -7615}, {0x1EA0, 48, 2, 1},
+    {0x1F08, 8, 1, -8}, {0x1F18, 6, 1, -8}, {0x1F28, 8, 1, -8}, {0x1F38, 8, 1, -8},
+    {0x1F48, 6, 1, -8}, {0x1F59, 4, 2, -8}, {0x1F68, 8, 1, -8}, {0x1F88, 8, 1, -8},
+    {0x1F98, 8, 1, -8}, {0x1FA8, 8, 1, -8}, {0x1FB8, 2, 1, -8}, {0x1FBA, 2, 1, -74},
+    {0x1FBC, 1, 1, -9}, {0x1FC8, 4, 1, -86}, {0x1FCC, 1, 1, -9}, {0x1FD8, 2, 1, -8},
+    {0x1FDA, 2, 1, -100}, {0x1FE8, 2, 1, -8}, {0x1FEA, 2, 1, -112}, {0x1FEC, 1, 1, -7},
+    {0x1FF8, 2, 1, -128}, {0x1FFA, 2, 1, -126}, {0x1FFC, 1, 1, -9}, {0x2126, 1, 1, -7517},
+    {0x212A, 1, 1, -8383}, {0x212B, 1, 1, -8262}, {0x2132, 1, 1, 28}, {0x2160, 16, 1, 16},
+    {0x2183, 1, 1, 1}, {0x24B6, 26, 1, 26}, {0x2C00, 48, 1, 48}, {0x2C60, 1, 1, 1},
+    {0x2C62, 1, 1, -10743}, {0x2C63, 1, 1, -3814}, {0x2C64, 1, 1, -10727}, {0x2C67, 3, 2, 1},
+    {0x2C6D, 1, 1, -10780}, {0x2C6E, 1, 1, -10749}, {0x2C6F, 1, 1, -10783}, {0x2C70, 1, 1, -10782},
+    {0x2C72, 1, 1, 1}, {0x2C75, 1, 1, 1}, {0x2C7E, 2, 1, -10815}, {0x2C80, 50, 2, 1},
+    {0x2CEB, 2, 2, 1}, {0x2CF2, 1, 1, 1}, {0xA640, 23, 2, 1}, {0xA680, 14, 2, 1},
+    {0xA722, 7, 2, 1}, {0xA732, 31, 2, 1}, {0xA779, 2, 2, 1}, {0xA77D, 1, 1, -35332},
+    {0xA77E, 5, 2, 1}, {0xA78B, 1, 1, 1}, {0xA78D, 1, 1, -42280}, {0xA790, 2, 2, 1},
+    {0xA796, 10, 2, 1}, {0xA7AA, 1, 1, -42308}, {0xA7AB, 1, 1, -42319}, {0xA7AC, 1, 1, -42315},
+    {0xA7AD, 1, 1, -42305}, {0xA7AE, 1, 1, -42308}, {0xA7B0, 1, 1, -42258}, {0xA7B1, 1, 1, -42282},
+    {0xA7B2, 1, 1, -42261}, {0xA7B3, 1, 1, 928}, {0xA7B4, 8, 2, 1}, {0xA7C4, 1, 1, -48},
+    {0xA7C5, 1, 1, -42307}, {0xA7C6, 1, 1, -35384}, {0xA7C7, 2, 2, 1}, {0xA7D0, 1, 1, 1},
+    {0xA7D6, 2, 2, 1}, {0xA7F5, 1, 1, 1}, {0xFF21, 26, 1, 32}, {0x10400, 40, 1, 40},
+    {0x104B0, 36, 1, 40}, {0x10570, 11, 1, 39}, {0x1057C, 15, 1, 39}, {0x1058C, 7, 1, 39},
+    {0x10594, 2, 1, 39}, {0x10C80, 51, 1, 64}, {0x118A0, 32, 1, 32}, {0x16E40, 32, 1, 32},
+    {0x1E900, 34, 1, 34},
+};
+static const CaseRange kFoldRanges[] = {
+    {0x00B5, 1, 1, 775}, {0x017F, 1, 1, -268}, {0x0345, 1, 1, 116}, {0x03C2, 1, 1, 1},
+    {0x03D0, 1, 1, -30}, {0x03D1, 1, 1, -25}, {0x03D5, 1, 1, -15}, {0x03D6, 1, 1, -22},
+    {0x03F0, 1, 1, -54}, {0x03F1, 1, 1, -48}, {0x03F5, 1, 1, -64}, {0x13A0, 86, 1, 0},
+    {0x13F8, 6, 1, -8}, {0x1C80, 1, 1, -6222}, {0x1C81, 1, 1, -6221}, {0x1C82, 1, 1, -6212},
+    {0x1C83, 2, 1, -6210}, {0x1C85, 1, 1, -6211}, {0x1C86, 1, 1, -6204}, {0x1C87, 1, 1, -6180},
+    {0x1C88, 1, 1, 35267}, {0x1E9B, 1, 1, -58}, {0x1FBE, 1, 1, -7173}, {0xAB70, 80, 1, -38864},
+};
+static const CaseSpecial kUpperSpecials[] = {
+    {0x00DF, {0x0053, 0x0053}}, {0x0149, {0x02BC, 0x004E}}, {0x01F0, {0x004A, 0x030C}},
+    {0x0390, {0x0399, 0x0308, 0x0301}}, {0x03B0, {0x03A5, 0x0308, 0x0301}}, {0x0587, {0x0535, 0x0552}},
+    {0x1E96, {0x0048, 0x0331}}, {0x1E97, {0x0054, 0x0308}}, {0x1E98, {0x0057, 0x030A}},
+    {0x1E99, {0x0059, 0x030A}}, {0x1E9A, {0x0041, 0x02BE}}, {0x1F50, {0x03A5, 0x0313}},
+    {0x1F52, {0x03A5, 0x0313, 0x0300}}, {0x1F54, {0x03A5, 0x0313, 0x0301}}, {0x1F56, {0x03A5, 0x0313, 0x0342}},
+    {0x1F80, {0x1F08, 0x0399}}, {0x1F81, {0x1F09, 0x0399}}, {0x1F82, {0x1F0A, 0x0399}},
+    {0x1F83, {0x1F0B, 0x0399}}, {0x1F84, {0x1F0C, 0x0399}}, {0x1F85, {0x1F0D, 0x0399}},
+    {0x1F86, {0x1F0E, 0x0399}}, {0x1F87, {0x1F0F, 0x0399}}, {0x1F88, {0x1F08, 0x0399}},
+    {0x1F89, {0x1F09, 0x0399}}, {0x1F8A, {0x1F0A, 0x0399}}, {0x1F8B, {0x1F0B, 0x0399}},
+    {0x1F8C, {0x1F0C, 0x0399}}, {0x1F8D, {0x1F0D, 0x0399}}, {0x1F8E, {0x1F0E, 0x0399}},
+    {0x1F8F, {0x1F0F, 0x0399}}, {0x1F90, {0x1F28, 0x0399}}, {0x1F91, {0x1F29, 0x0399}},
+    {0x1F92, {0x1F2A, 0x0399}}, {0x1F93, {0x1F2B, 0x0399}}, {0x1F94, {0x1F2C, 0x0399}},
+    {0x1F95, {0x1F2D, 0x0399}}, {0x1F96, {0x1F2E, 0x0399}}, {0x1F97, {0x1F2F, 0x0399}},
+    {0x1F98, {0x1F28, 0x0399}}, {0x1F99, {0x1F29, 0x0399}}, {0x1F9A, {0x1F2A, 0x0399}},
+    {0x1F9B, {0x1F2B, 0x0399}}, {0x1F9C, {0x1F2C, 0x0399}}, {0x1F9D, {0x1F2D, 0x0399}},
+    {0x1F9E, {0x1F2E, 0x0399}}, {0x1F9F, {0x1F2F, 0x0399}}, {0x1FA0, {0x1F68, 0x0399}},
+    {0x1FA1, {0x1F69, 0x0399}}, {0x1FA2, {0x1F6A, 0x0399}}, {0x1FA3, {0x1F6B, 0x0399}},
+    {0x1FA4, {0x1F6C, 0x0399}}, {0x1FA5, {0x1F6D, 0x0399}}, {0x1FA6, {0x1F6E, 0x0399}},
+    {0x1FA7, {0x1F6F, 0x0399}}, {0x1FA8, {0x1F68, 0x0399}}, {0x1FA9, {0x1F69, 0x0399}},
+    {0x1FAA, {0x1F6A, 0x0399}}, {0x1FAB, {0x1F6B, 0x0399}}, {0x1FAC, {0x1F6C, 0x0399}},
+    {0x1FAD, {0x1F6D, 0x0399}}, {0x1FAE, {0x1F6E, 0x0399}}, {0x1FAF, {0x1F6F, 0x0399}},
+    {0x1FB2, {0x1FBA, 0x0399}}, {0x1FB3, {0x0391, 0x0399}}, {0x1FB4, {0x0386, 0x0399}},
+    {0x1FB6, {0x0391, 0x0342}}, {0x1FB7, {0x0391, 0x0342, 0x0399}}, {0x1FBC, {0x0391, 0x0399}},
+    {0x1FC2, {0x1FCA, 0x0399}}, {0x1FC3, {0x0397, 0x0399}}, {0x1FC4, {0x0389, 0x0399}},
+    {0x1FC6, {0x0397, 0x0342}}, {0x1FC7, {0x0397, 0x0342, 0x0399}}, {0x1FCC, {0x0397, 0x0399}},
+    {0x1FD2, {0x0399, 0x0308, 0x0300}}, {0x1FD3, {0x0399, 0x0308, 0x0301}}, {0x1FD6, {0x0399, 0x0342}},
+    {0x1FD7, {0x0399, 0x0308, 0x0342}}, {0x1FE2, {0x03A5, 0x0308, 0x0300}}, {0x1FE3, {0x03A5, 0x0308, 0x0301}},
+    {0x1FE4, {0x03A1, 0x0313}}, {0x1FE6, {0x03A5, 0x0342}}, {0x1FE7, {0x03A5, 0x0308, 0x0342}},
+    {0x1FF2, {0x1FFA, 0x0399}}, {0x1FF3, {0x03A9, 0x0399}}, {0x1FF4, {0x038F, 0x0399}},
+    {0x1FF6, {0x03A9, 0x0342}}, {0x1FF7, {0x03A9, 0x0342, 0x0399}}, {0x1FFC, {0x03A9, 0x0399}},
+    {0xFB00, {0x0046, 0x0046}}, {0xFB01, {0x0046, 0x0049}}, {0xFB02, {0x0046, 0x004C}},
+    {0xFB03, {0x0046, 0x0046, 0x0049}}, {0xFB04, {0x0046, 0x0046, 0x004C}}, {0xFB05, {0x0053, 0x0054}},
+    {0xFB06, {0x0053, 0x0054}}, {0xFB13, {0x0544, 0x0546}}, {0xFB14, {0x0544, 0x0535}},
+    {0xFB15, {0x0544, 0x053B}}, {0xFB16, {0x054E, 0x0546}}, {0xFB17, {0x0544, 0x053D}},
+};
+
+class UnicodeCase {
+public:
+    // Повне відображення: до трьох кодових точок, повертає їх кількість
+    static size_t map(char32_t cp, CaseMapping mode, char32_t out[3]) {
+        const Table& t = table(mode);
+        int32_t d = t.deltas[cp];
+        if (d >= kSpecialTag) {
+            const std::array<char32_t, 3>& sp = t.specials[d - kSpecialTag];
+            size_t k = 0;
+            while (k < 3 && sp[k]) {
+                out[k] = sp[k];
+                ++k;
+            }
+            return k;
+        }
+        out[0] = char32_t(int32_t(cp) + d);
+        return 1;
+    }
+
+    // Просте відображення 1:1 (кодові точки з багатосимвольним відображенням лишаються як є)
+    static char32_t map_simple(char32_t cp, CaseMapping mode) {
+        int32_t d = table(mode).deltas[cp];
+        return d >= kSpecialTag ? cp : char32_t(int32_t(cp) + d);
+    }
+
+private:
+    static constexpr int32_t kSpecialTag = 0x40000000;
+
+    struct Table {
+        CodePointTable<int32_t> deltas;
+        std::vector<std::array<char32_t, 3>> specials;
+    };
+
+    template <size_t N>
+    static void put_ranges(Table& t, const CaseRange (&ranges)[N]) {
+        for (const CaseRange& r : ranges)
+            for (size_t i = 0; i < r.count; ++i) t.deltas.set(r.first + char32_t(i * r.stride), r.delta);
+    }
+
+    static void put_special(Table& t, char32_t cp, std::array<char32_t, 3> to) {
+        t.deltas.set(cp, kSpecialTag + int32_t(t.specials.size()));
+        t.specials.push_back(to);
+    }
+
+    static Table build(CaseMapping mode) {
+        Table t;
+        if (mode == CaseMapping::Upper) {
+            put_ranges(t, kUpperRanges);
+            for (const CaseSpecial& sp : kUpperSpecials) put_special(t, sp.cp, {sp.to[0], sp.to[1], sp.to[2]});
+        } else {
+            put_ranges(t, kLowerRanges);
+            if (mode == CaseMapping::Fold) put_ranges(t, kFoldRanges);
+            put_special(t, 0x0130, {0x0069, 0x0307, 0});
+            if (mode == CaseMapping::Fold) {
+                // Повне згортання збігається з малими літерами повного верхнього регістру
+                for (const CaseSpecial& sp : kUpperSpecials) {
+                    std::array<char32_t, 3> to{};
+                    for (size_t k = 0; k < 3 && sp.to[k]; ++k) to[k] = map_simple(sp.to[k], CaseMapping::Lower);
+                    put_special(t, sp.cp, to);
+                }
+                put_special(t, 0x1E9E, {0x0073, 0x0073, 0});
+            }
+        }
+        t.deltas.finish();
+        return t;
+    }
+
+    static const Table& table(CaseMapping mode) {
+        if (mode == CaseMapping::Upper) {
+            static const Table upper = build(CaseMapping::Upper);
+            return upper;
+        }
+        if (mode == CaseMapping::Lower) {
+            static const Table lower = build(CaseMapping::Lower);
+            return lower;
+        }
+        static const Table fold = build(CaseMapping::Fold);
+        return fold;
+    }
+};
+
+inline char ascii_case(char c, CaseMapping mode) {
+    if (mode == CaseMapping::Upper) return (c >= 'a' && c <= 'z') ? char(c - 32) : c;
+    return (c >= 'A' && c <= 'Z') ? char(c + 32) : c;
+}
+
+// Зміна регістру UTF-8 рядка; ASCII-блоки по 16 байтів обробляються в SIMD-регістрах,
+// таблиці використовуються лише для не-ASCII послідовностей. Некоректні байти копіюються як є.
+inline String<char> case_mapped(const String<char>& s, CaseMapping mode) {
+    const char* p = s.begin();
+    size_t n = s.size();
+    String<char> out;
+    out.reserve(n);
+    size_t i = 0;
+#ifdef STRING_HAS_SSE2
+    const char first = mode == CaseMapping::Upper ? 'a' : 'A';
+    const __m128i lo = _mm_set1_epi8(char(first - 1));
+    const __m128i hi = _mm_set1_epi8(char(first + 26));
+    const __m128i flip = _mm_set1_epi8(0x20);
+#endif
+    while (i < n) {
+#ifdef STRING_HAS_SSE2
+        while (i + 16 <= n) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            if (_mm_movemask_epi8(v)) break;
+            __m128i in = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+            v = _mm_xor_si128(v, _mm_and_si128(in, flip));
+            char buf[16];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(buf), v);
+            out.append(buf, 16);
+            i += 16;
+        }
+        if (i >= n) break;
+#endif
+        if (static_cast<unsigned char>(p[i]) < 0x80) {
+            out += ascii_case(p[i], mode);
+            ++i;
+            continue;
+        }
+        char32_t cp;
+        size_t len = utf8_decode(p + i, n - i, cp);
+        if (cp == kInvalidCodePoint) {
+            out += p[i];
+            ++i;
+            continue;
+        }
+        char32_t mapped[3];
+        size_t k = UnicodeCase::map(cp, mode, mapped);
+        char buf[12];
+        size_t w = 0;
+        for (size_t j = 0; j < k; ++j) w += utf8_encode(mapped[j], buf + w);
+        out.append(buf, w);
+        i += len;
+    }
+    return out;
+}
+
+inline String<char32_t> case_mapped(const String<char32_t>& s, CaseMapping mode) {
+    String<char32_t> out;
+    out.reserve(s.size());
+    for (char32_t cp : s) {
+        if (cp < 0x80) {
+            out += char32_t(ascii_case(char(cp), mode));
+            continue;
+        }
+        char32_t mapped[3];
+        size_t k = UnicodeCase::map(cp, mode, mapped);
+        out.append(mapped, k);
+    }
+    return out;
+}
+
+template <typename T>
+String<T> to_upper(const String<T>& s) { return case_mapped(s, CaseMapping::Upper); }
+
+template <typename T>
+String<T> to_lower(const String<T>& s) { return case_mapped(s, CaseMapping::Lower); }
+
+template <typename T>
+String<T> case_fold(const String<T>& s) { return case_mapped(s, CaseMapping::Fold); }
+
+// Нормалізація Unicode (NFC/NFD/NFKC/NFKD)
+// Класи комбінування, канонічні й сумісні розклади та виключення з композиції — повні (UnicodeData 14.0,
+// згенеровано з нього ж); склади хангиль розкладаються алгоритмічно. Кодові точки, що з'явилися
+// після Unicode 14, вважаються такими, що не мають розкладу.
+enum class NormalizationForm { NFC, NFD, NFKC, NFKD };
+enum class QuickCheckResult { Yes, No, Maybe };
+
+struct CanonicalDecomposition {
+    char32_t cp;
+    char32_t first;
+    char32_t second;
+};
+
+struct CompatRange {
+    char32_t first;
+    uint16_t count;
+    int32_t delta;
+};
+
+struct CompatDecomposition {
+    char32_t cp;
+    char32_t to[4];
+};
+
+struct CompatLongDecomposition {
+    char32_t cp;
+    char32_t to[18];
+};
+
+struct CombiningClassRange {
+    char32_t first;
+    uint16_t count;
+    uint8_t ccc;
+};
+
+static const CanonicalDecomposition kCanonicalDecompositions[] = {
+    {0x00C0, 0x0041, 0x0300}, {0x00C1, 0x0041, 0x0301}, {0x00C2, 0x0041, 0x0302}, {0x00C3, 0x0041, 0x0303},
+    {0x00C4, 0x0041, 0x0308}, {0x00C5, 0x0041, 0x030A}, {0x00C7, 0x0043, 0x0327}, {0x00C8, 0x0045, 0x0300},
+    {0x00C9, 0x0045, 0x0301}, {0x00CA, 0x0045, 0x0302}, {0x00CB, 0x0045, 0x0308}, {0x00CC, 0x0049, 0x0300},
+    {0x00CD, 0x0049, 0x0301}, {0x00CE, 0x0049, 0x0302}, {0x00CF, 0x0049, 0x0308}, {0x00D1, 0x004E, 0x0303},
+    {0x00D2, 0x004F, 0x0300}, {0x00D3, 0x004F, 0x0301}, {0x00D4, 0x004F, 0x0302}, {0x00D5, 0x004F, 0x0303},
+    {0x00D6, 0x004F, 0x0308}, {0x00D9, 0x0055, 0x0300}, {0x00DA, 0x0055, 0x0301}, {0x00DB, 0x0055, 0x0302},
+    {0x00DC, 0x0055, 0x0308}, {0x00DD, 0x0059, 0x0301}, {0x00E0, 0x0061, 0x0300}, {0x00E1, 0x0061, 0x0301},
+    {0x00E2, 0x0061, 0x0302}, {0x00E3, 0x0061, 0x0303}, {0x00E4, 0x0061, 0x0308}, {0x00E5, 0x0061, 0x030A},
+    {0x00E7, 0x0063, 0x0327}, {0x00E8, 0x0065, 0x0300}, {0x00E9, 0x0065, 0x0301}, {0x00EA, 0x0065, 0x0302},
+    {0x00EB, 0x0065, 0x0308}, {0x00EC, 0x0069, 0x0300}, {0x00ED, 0x0069, 0x0301}, {0x00EE, 0x0069, 0x0302},
+    {0x00EF, 0x0069, 0x0308}, {0x00F1, 0x006E, 0x0303}, {0x00F2, 0x006F, 0x0300}, {0x00F3, 0x006F, 0x0301},
+    {0x00F4, 0x006F, 0x0302}, {0x00F5, 0x006F, 0x0303}, {0x00F6, 0x006F, 0x0308}, {0x00F9, 0x0075, 0x0300},
+    {0x00FA, 0x0075, 0x0301}, {0x00FB, 0x0075, 0x0302}, {0x00FC, 0x0075, 0x0308}, {0x00FD, 0x0079, 0x0301},
+    {0x00FF, 0x0079, 0x0308}, {0x0100, 0x0041, 0x0304}, {0x0101, 0x0061, 0x0304}, {0x0102, 0x0041, 0x0306},
+    {0x0103, 0x0061, 0x0306}, {0x0104, 0x0041, 0x0328}, {0x0105, 0x0061, 0x0328}, {0x0106, 0x0043, 0x0301},
+    {0x0107, 0x0063, 0x0301}, {0x0108, 0x0043, 0x0302}, {0x0109, 0x0063, 0x0302}, {0x010A, 0x0043, 0x0307},
+    {0x010B, 0x0063, 0x0307}, {0x010C, 0x0043, 0x030C}, {0x010D, 0x0063, 0x030C}, {0x010E, 0x0044, 0x030C},
+    {0x010F, 0x0064, 0x030C}, {0x0112, 0x0045, 0x0304}, {0x0113, 0x0065, 0x0304}, {0x0114, 0x0045, 0x0306},
+    {0x0115, 0x0065, 0x0306}, {0x0116, 0x0045, 0x0307}, {0x0117, 0x0065, 0x0307}, {0x0118, 0x0045, 0x0328},
+    {0x0119, 0x0065, 0x0328}, {0x011A, 0x0045, 0x030C}, {0x011B, 0x0065, 0x030C}, {0x011C, 0x0047, 0x0302},
+    {0x011D, 0x0067, 0x0302}, {0x011E, 0x0047, 0x0306}, {0x011F, 0x0067, 0x0306}, {0x0120, 0x0047, 0x0307},
+    {0x0121, 0x0067, 0x0307}, {0x0122, 0x0047, 0x0327}, {0x0123, 0x0067, 0x0327}, {0x0124, 0x0048, 0x0302},
+    {0x0125, 0x0068, 0x0302}, {0x0128, 0x0049, 0x0303}, {0x0129, 0x0069, 0x0303}, {0x012A, 0x0049, 0x0304},
+    {0x012B, 0x0069, 0x0304}, {0x012C, 0x0049, 0x0306}, {0x012D, 0x0069, 0x0306}, {0x012E, 0x0049, 0x0328},
+    {0x012F, 0x0069, 0x0328}, {0x0130, 0x0049, 0x0307}, {0x0134, 0x004A, 0x0302}, {0x0135, 0x006A, 0x0302},
+    {0x0136, 0x004B, 0x0327}, {0x0137, 0x006B, 0x0327}, {0x0139, 0x004C, 0x0301}, {0x013A, 0x006C, 0x0301},
+    {0x013B, 0x004C, 0x0327}, {0x013C, 0x006C, 0x0327}, {0x013D, 0x004C, 0x030C}, {0x013E, 0x006C, 0x030C},
+    {0x0143, 0x004E, 0x0301}, {0x0144, 0x006E, 0x0301}, {0x0145, 0x004E, 0x0327}, {0x0146, 0x006E, 0x0327},
+    {0x0147, 0x004E, 0x030C}, {0x0148, 0x006E, 0x030C}, {0x014C, 0x004F, 0x0304}, {0x014D, 0x006F, 0x0304},
+    {0x014E, 0x004F, 0x0306}, {0x014F, 0x006F, 0x0306}, {0x0150, 0x004F, 0x030B}, {0x0151, 0x006F, 0x030B},
+    {0x0154, 0x0052, 0x0301}, {0x0155, 0x0072, 0x0301}, {0x0156, 0x0052, 0x0327}, {0x0157, 0x0072, 0x0327},
+    {0x0158, 0x0052, 0x030C}, {0x0159, 0x0072, 0x030C}, {0x015A, 0x0053, 0x0301}, {0x015B, 0x0073, 0x0301},
+    {0x015C, 0x0053, 0x0302}, {0x015D, 0x0073, 0x0302}, {0x015E, 0x0053, 0x0327}, {0x015F, 0x0073, 0x0327},
+    {0x0160, 0x0053, 0x030C}, {0x0161, 0x0073, 0x030C}, {0x0162, 0x0054, 0x0327}, {0x0163, 0x0074, 0x0327},
+    {0x0164, 0x0054, 0x030C}, {0x0165, 0x0074, 0x030C}, {0x0168, 0x0055, 0x0303}, {0x0169, 0x0075, 0x0303},
+    {0x016A, 0x0055, 0x0304}, {0x016B, 0x0075, 0x0304}, {0x016C, 0x0055, 0x0306}, {0x016D, 0x0075, 0x0306},
+    {0x016E, 0x0055, 0x030A}, {0x016F, 0x0075, 0x030A}, {0x0170, 0x0055, 0x030B}, {0x0171, 0x0075, 0x030B},
+    {0x0172, 0x0055, 0x0328}, {0x0173, 0x0075, 0x0328}, {0x0174, 0x0057, 0x0302}, {0x0175, 0x0077, 0x0302},
+    {0x0176, 0x0059, 0x0302}, {0x0177, 0x0079, 0x0302}, {0x0178, 0x0059, 0x0308}, {0x0179, 0x005A, 0x0301},
+    {0x017A, 0x007A, 0x0301}, {0x017B, 0x005A, 0x0307}, {0x017C, 0x007A, 0x0307}, {0x017D, 0x005A, 0x030C},
+    {0x017E, 0x007A, 0x030C}, {0x01A0, 0x004F, 0x031B}, {0x01A1, 0x006F, 0x031B}, {0x01AF, 0x0055, 0x031B},
+    {0x01B0, 0x0075, 0x031B}, {0x01CD, 0x0041, 0x030C}, {0x01CE, 0x0061, 0x030C}, {0x01CF, 0x0049, 0x030C},
+    {0x01D0, 0x0069, 0x030C}, {0x01D1, 0x004F, 0x030C}, {0x01D2, 0x006F, 0x030C}, {0x01D3, 0x0055, 0x030C},
+    {0x01D4, 0x0075, 0x030C}, {0x01D5, 0x00DC, 0x0304}, {0x01D6, 0x00FC, 0x0304}, {0x01D7, 0x00DC, 0x0301},
+    {0x01D8, 0x00FC, 0x0301}, {0x01D9, 0x00DC, 0x030C}, {0x01DA, 0x00FC, 0x030C}, {0x01DB, 0x00DC, 0x0300},
+    {0x01DC, 0x00FC, 0x0300}, {0x01DE, 0x00C4, 0x0304}, {0x01DF, 0x00E4, 0x0304}, {0x01E0, 0x0226, 0x0304},
+    {0x01E1, 0x0227, 0x0304}, {0x01E2, 0x00C6, 0x0304}, {0x01E3, 0x00E6, 0x0304}, {0x01E6, 0x0047, 0x030C},
+    {0x01E7, 0x0067, 0x030C}, {0x01E8, 0x004B, 0x030C}, {0x01E9, 0x006B, 0x030C}, {0x01EA, 0x004F, 0x0328},
+    {0x01EB, 0x006F, 0x0328}, {0x01EC, 0x01EA, 0x0304}, {0x01ED, 0x01EB, 0x0304}, {0x01EE, 0x01B7, 0x030C},
+    {0x01EF, 0x0292, 0x030C}, {0x01F0, 0x006A, 0x030C}, {0x01F4, 0x0047, 0x0301}, {0x01F5, 0x0067, 0x0301},
+    {0x01F8, 0x004E, 0x0300}, {0x01F9, 0x006E, 0x0300}, {0x01FA, 0x00C5, 0x0301}, {0x01FB, 0x00E5, 0x0301},
+    {0x01FC, 0x00C6, 0x0301}, {0x01FD, 0x00E6, 0x0301}, {0x01FE, 0x00D8, 0x0301}, {0x01FF, 0x00F8, 0x0301},
+    {0x0200, 0x0041, 0x030F}, {0x0201, 0x0061, 0x030F}, {0x0202, 0x0041, 0x0311}, {0x0203, 0x0061, 0x0311},
+    {0x0204, 0x0045, 0x030F}, {0x0205, 0x0065, 0x030F}, {0x0206, 0x0045, 0x0311}, {0x0207, 0x0065, 0x0311},
+    {0x0208, 0x0049, 0x030F}, {0x0209, 0x0069, 0x030F}, {0x020A, 0x0049, 0x0311}, {0x020B, 0x0069, 0x0311},
+    {0x020C, 0x004F, 0x030F}, {0x020D, 0x006F, 0x030F}, {0x020E, 0x004F, 0x0311}, {0x020F, 0x006F, 0x0311},
+    {0x0210, 0x0052, 0x030F}, {0x0211, 0x0072, 0x030F}, {0x0212, 0x0052, 0x0311}, {0x0213, 0x0072, 0x0311},
+    {0x0214, 0x0055, 0x030F}, {0x0215, 0x0075, 0x030F}, {0x0216, 0x0055, 0x0311}, {0x0217, 0x0075, 0x0311},
+    {0x0218, 0x0053, 0x0326}, {0x0219, 0x0073, 0x0326}, {0x021A, 0x0054, 0x0326}, {0x021B, 0x0074, 0x0326},
+    {0x021E, 0x0048, 0x030C}, {0x021F, 0x0068, 0x030C}, {0x0226, 0x0041, 0x0307}, {0x0227, 0x0061, 0x0307},
+    {0x0228, 0x0045, 0x0327}, {0x0229, 0x0065, 0x0327}, {0x022A, 0x00D6, 0x0304}, {0x022B, 0x00F6, 0x0304},
+    {0x022C, 0x00D5, 0x0304}, {0x022D, 0x00F5, 0x0304}, {0x022E, 0x004F, 0x0307}, {0x022F, 0x006F, 0x0307},
+    {0x0230, 0x022E, 0x0304}, {0x0231, 0x022F, 0x0304}, {0x0232, 0x0059, 0x0304}, {0x0233, 0x0079, 0x0304},
+    {0x0340, 0x0300, 0x0000}, {0x0341, 0x0301, 0x0000}, {0x0343, 0x0313, 0x0000}, {0x0344, 0x0308, 0x0301},
+    {0x0374, 0x02B9, 0x0000}, {0x037E, 0x003B, 0x0000}, {0x0385, 0x00A8, 0x0301}, {0x0386, 0x0391, 0x0301},
+    {0x0387, 0x00B7, 0x0000}, {0x0388, 0x0395, 0x0301}, {0x0389, 0x0397, 0x0301}, {0x038A, 0x0399, 0x0301},
+    {0x038C, 0x039F, 0x0301}, {0x038E, 0x03A5, 0x0301}, {0x038F, 0x03A9, 0x0301}, {0x0390, 0x03CA, 0x0301},
+    {0x03AA, 0x0399, 0x0308}, {0x03AB, 0x03A5, 0x0308}, {0x03AC, 0x03B1, 0x0301}, {0x03AD, 0x03B5, 0x0301},
+    {0x03AE, 0x03B7, 0x0301}, {0x03AF, 0x03B9, 0x0301}, {0x03B0, 0x03CB, 0x0301}, {0x03CA, 0x03B9, 0x0308},
+    {0x03CB, 0x03C5, 0x0308}, {0x03CC, 0x03BF, 0x0301}, {0x03CD, 0x03C5, 0x0301}, {0x03CE, 0x03C9, 0x0301},
+    {0x03D3, 0x03D2, 0x0301}, {0x03D4, 0x03D2, 0x0308}, {0x0400, 0x0415, 0x0300}, {0x0401, 0x0415, 0x0308},
+    {0x0403, 0x0413, 0x0301}, {0x0407, 0x0406, 0x0308}, {0x040C, 0x041A, 0x0301}, {0x040D, 0x0418, 0x0300},
+    {0x040E, 0x0423, 0x0306}, {0x0419, 0x0418, 0x0306}, {0x0439, 0x0438, 0x0306}, {0x0450, 0x0435, 0x0300},
+    {0x0451, 0x0435, 0x0308}, {0x0453, 0x0433, 0x0301}, {0x0457, 0x0456, 0x0308}, {0x045C, 0x043A, 0x0301},
+    {0x045D, 0x0438, 0x0300}, {0x045E, 0x0443, 0x0306}, {0x0476, 0x0474, 0x030F}, {0x0477, 0x0475, 0x030F},
+    {0x04C1, 0x0416, 0x0306}, {0x04C2, 0x0436, 0x0306}, {0x04D0, 0x0410, 0x0306}, {0x04D1, 0x0430, 0x0306},
+    {0x04D2, 0x0410, 0x0308}, {0x04D3, 0x0430, 0x0308}, {0x04D6, 0x0415, 0x0306}, {0x04D7, 0x0435, 0x0306},
+    {0x04DA, 0x04D8, 0x0308}, {0x04DB, 0x04D9, 0x0308}, {0x04DC, 0x0416, 0x0308}, {0x04DD, 0x0436, 0x0308},
+    {0x04DE, 0x0417, 0x0308}, {0x04DF, 0x0437, 0x0308}, {0x04E2, 0x0418, 0x0304}, {0x04E3, 0x0438, 0x0304},
+    {0x04E4, 0x0418, 0x0308}, {0x04E5, 0x0438, 0x0308}, {0x04E6, 0x041E, 0x0308}, {0x04E7, 0x043E, 0x0308},
+    {0x04EA, 0x04E8, 0x0308}, {0x04EB, 0x04E9, 0x0308}, {0x04EC, 0x042D, 0x0308}, {0x04ED, 0x044D, 0x0308},
+    {0x04EE, 0x0423, 0x0304}, {0x04EF, 0x0443, 0x0304}, {0x04F0, 0x0423, 0x0308}, {0x04F1, 0x0443, 0x0308},
+    {0x04F2, 0x0423, 0x030B}, {0x04F3, 0x0443, 0x030B}, {0x04F4, 0x0427, 0x0308}, {0x04F5, 0x0447, 0x0308},
+    {0x04F8, 0x042B, 0x0308}, {0x04F9, 0x044B, 0x0308}, {0x0622, 0x0627, 0x0653}, {0x0623, 0x0627, 0x0654},
+    {0x0624, 0x0648, 0x0654}, {0x0625, 0x0627, 0x0655}, {0x0626, 0x064A, 0x0654}, {0x06C0, 0x06D5, 0x0654},
+    {0x06C2, 0x06C1, 0x0654}, {0x06D3, 0x06D2, 0x0654}, {0x0929, 0x0928, 0x093C}, {0x0931, 0x0930, 0x093C},
+    {0x0934, 0x0933, 0x093C}, {0x0958, 0x0915, 0x093C}, {0x0959, 0x0916, 0x093C}, {0x095A, 0x0917, 0x093C},
+    {0x095B, 0x091C, 0x093C}, {0x095C, 0x0921, 0x093C}, {0x095D, 0x0922, 0x093C}, {0x095E, 0x092B, 0x093C},
+    {0x095F, 0x092F, 0x093C}, {0x09CB, 0x09C7, 0x09BE}, {0x09CC, 0x09C7, 0x09D7}, {0x09DC, 0x09A1, 0x09BC},
+    {0x09DD, 0x09A2, 0x09BC}, {0x09DF, 0x09AF, 0x09BC}, {0x0A33, 0x0A32, 0x0A3C}, {0x0A36, 0x0A38, 0x0A3C},
+    {0x0A59, 0x0A16, 0x0A3C}, {0x0A5A, 0x0A17, 0x0A3C}, {0x0A5B, 0x0A1C, 0x0A3C}, {0x0A5E, 0x0A2B, 0x0A3C},
+    {0x0B48, 0x0B47, 0x0B56}, {0x0B4B, 0x0B47, 0x0B3E}, {0x0B4C, 0x0B47, 0x0B57}, {0x0B5C, 0x0B21, 0x0B3C},
+    {0x0B5D, 0x0B22, 0x0B3C}, {0x0B94, 0x0B92, 0x0BD7}, {0x0BCA, 0x0BC6, 0x0BBE}, {0x0BCB, 0x0BC7, 0x0BBE},
+    {0x0BCC, 0x0BC6, 0x0BD7}, {0x0C48, 0x0C46, 0x0C56}, {0x0CC0, 0x0CBF, 0x0CD5}, {0x0CC7, 0x0CC6, 0x0CD5},
+    {0x0CC8, 0x0CC6, 0x0CD6}, {0x0CCA, 0x0CC6, 0x0CC2}, {0x0CCB, 0x0CCA, 0x0CD5}, {0x0D4A, 0x0D46, 0x0D3E},
+    {0x0D4B, 0x0D47, 0x0D3E}, {0x0D4C, 0x0D46, 0x0D57}, {0x0DDA, 0x0DD9, 0x0DCA}, {0x0DDC, 0x0DD9, 0x0DCF},
+    {0x0DDD, 0x0DDC, 0x0DCA}, {0x0DDE, 0x0DD9, 0x0DDF}, {0x0F43, 0x0F42, 0x0FB7}, {0x0F4D, 0x0F4C, 0x0FB7},
+    {0x0F52, 0x0F51, 0x0FB7}, {0x0F57, 0x0F56, 0x0FB7}, {0x0F5C, 0x0F5B, 0x0FB7}, {0x0F69, 0x0F40, 0x0FB5},
+    {0x0F73, 0x0F71, 0x0F72}, {0x0F75, 0x0F71, 0x0F74}, {0x0F76, 0x0FB2, 0x0F80}, {0x0F78, 0x0FB3, 0x0F80},
+    {0x0F81, 0x0F71, 0x0F80}, {0x0F93, 0x0F92, 0x0FB7}, {0x0F9D, 0x0F9C, 0x0FB7}, {0x0FA2, 0x0FA1, 0x0FB7},
+    {0x0FA7, 0x0FA6, 0x0FB7}, {0x0FAC, 0x0FAB, 0x0FB7}, {0x0FB9, 0x0F90, 0x0FB5}, {0x1026, 0x1025, 0x102E},
+    {0x1B06, 0x1B05, 0x1B35}, {0x1B08, 0x1B07, 0x1B35}, {0x1B0A, 0x1B09, 0x1B35}, {0x1B0C, 0x1B0B, 0x1B35},
+    {0x1B0E, 0x1B0D, 0x1B35}, {0x1B12, 0x1B11, 0x1B35}, {0x1B3B, 0x1B3A, 0x1B35}, {0x1B3D, 0x1B3C, 0x1B35},
+    {0x1B40, 0x1B3E, 0x1B35}, {0x1B41, 0x1B3F, 0x1B35}, {0x1B43, 0x1B42, 0x1B35}, {0x1E00, 0x0041, 0x0325},
+    {0x1E01, 0x0061, 0x0325}, {0x1E02, 0x0042, 0x0307}, {0x1E03, 0x0062, 0x0307}, {0x1E04, 0x0042, 0x0323},
+    {0x1E05, 0x0062, 0x0323}, {0x1E06, 0x0042, 0x0331}, {0x1E07, 0x0062, 0x0331}, {0x1E08, 0x00C7, 0x0301},
+    {0x1E09, 0x00E7, 0x0301}, {0x1E0A, 0x0044, 0x0307}, {0x1E0B, 0x0064, 0x0307}, {0x1E0C, 0x0044, 0x0323},
+    {0x1E0D, 0x0064, 0x0323}, {0x1E0E, 0x0044, 0x0331}, {0x1E0F, 0x0064, 0x0331}, {0x1E10, 0x0044, 0x0327},
+    {0x1E11, 0x0064, 0x0327}, {0x1E12, 0x0044, 0x032D}, {0x1E13, 0x0064, 0x032D}, {0x1E14, 0x0112, 0x0300},
+    {0x1E15, 0x0113, 0x0300}, {0x1E16, 0x0112, 0x0301}, {0x1E17, 0x0113, 0x0301}, {0x1E18, 0x0045, 0x032D},
+    {0x1E19, 0x0065, 0x032D}, {0x1E1A, 0x0045, 0x0330}, {0x1E1B, 0x0065, 0x0330}, {0x1E1C, 0x0228, 0x0306},
+    {0x1E1D, 0x0229, 0x0306}, {0x1E1E, 0x0046, 0x0307}, {0x1E1F, 0x0066, 0x0307}, {0x1E20, 0x0047, 0x0304},
+    {0x1E21, 0x0067, 0x0304}, {0x1E22, 0x0048, 0x0307}, {0x1E23, 0x0068, 0x0307}, {0x1E24, 0x0048, 0x0323},
+    {0x1E25, 0x0068, 0x0323}, {0x1E26, 0x0048, 0x0308}, {0x1E27, 0x0068, 0x0308}, {0x1E28, 0x0048, 0x0327},
+    {0x1E29, 0x0068, 0x0327}, {0x1E2A, 0x0048, 0x032E}, {0x1E2B, 0x0068, 0x032E}, {0x1E2C, 0x0049, 0x0330},
+    {0x1E2D, 0x0069, 0x0330}, {0x1E2E, 0x00CF, 0x0301}, {0x1E2F, 0x00EF, 0x0301}, {0x1E30, 0x004B, 0x0301},
+    {0x1E31, 0x006B, 0x0301}, {0x1E32, 0x004B, 0x0323}, {0x1E33, 0x006B, 0x0323}, {0x1E34, 0x004B, 0x0331},
+    {0x1E35, 0x006B, 0x0331}, {0x1E36, 0x004C, 0x0323}, {0x1E37, 0x006C, 0x0323}, {0x1E38, 0x1E36, 0x0304},
+    {0x1E39, 0x1E37, 0x0304}, {0x1E3A, 0x004C, 0x0331}, {0x1E3B, 0x006C, 0x0331}, {0x1E3C, 0x004C, 0x032D},
+    {0x1E3D, 0x006C, 0x032D}, {0x1E3E, 0x004D, 0x0301}, {0x1E3F, 0x006D, 0x0301}, {0x1E40, 0x004D, 0x0307},
+    {0x1E41, 0x006D, 0x0307}, {0x1E42, 0x004D, 0x0323}, {0x1E43, 0x006D, 0x0323}, {0x1E44, 0x004E, 0x0307},
+    {0x1E45, 0x006E, 0x0307}, {0x1E46, 0x004E, 0x0323}, {0x1E47, 0x006E, 0x0323}, {0x1E48, 0x004E, 0x0331},
+    {0x1E49, 0x006E, 0x0331}, {0x1E4A, 0x004E, 0x032D}, {0x1E4B, 0x006E, 0x032D}, {0x1E4C, 0x00D5, 0x0301},
+    {0x1E4D, 0x00F5, 0x0301}, {0x1E4E, 0x00D5, 0x0308}, {0x1E4F, 0x00F5, 0x0308}, {0x1E50, 0x014C, 0x0300},
+    {0x1E51, 0x014D, 0x0300}, {0x1E52, 0x014C, 0x0301}, {0x1E53, 0x014D, 0x0301}, {0x1E54, 0x0050, 0x0301},
+    {0x1E55, 0x0070, 0x0301}, {0x1E56, 0x0050, 0x0307}, {0x1E57, 0x0070, 0x0307}, {0x1E58, 0x0052, 0x0307},
+    {0x1E59, 0x0072, 0x0307}, {0x1E5A, 0x0052, 0x0323}, {0x1E5B, 0x0072, 0x0323}, {0x1E5C, 0x1E5A, 0x0304},
+    {0x1E5D, 0x1E5B, 0x0304}, {0x1E5E, 0x0052, 0x0331}, {0x1E5F, 0x0072, 0x0331}, {0x1E60, 0x0053, 0x0307},
+    {0x1E61, 0x0073, 0x0307}, {0x1E62, 0x0053, 0x0323}, {0x1E63, 0x0073, 0x0323}, {0x1E64, 0x015A, 0x0307},
+    {0x1E65, 0x015B, 0x0307}, {0x1E66, 0x0160, 0x0307}, {0x1E67, 0x0161, 0x0307}, {0x1E68, 0x1E62, 0x0307},
+    {0x1E69, 0x1E63, 0x0307}, {0x1E6A, 0x0054, 0x0307}, {0x1E6B, 0x0074, 0x0307}, {0x1E6C, 0x0054, 0x0323},
+    {0x1E6D, 0x0074, 0x0323}, {0x1E6E, 0x0054, 0x0331}, {0x1E6F, 0x0074, 0x0331}, {0x1E70, 0x0054, 0x032D},
+    {0x1E71, 0x0074, 0x032D}, {0x1E72, 0x0055, 0x0324}, {0x1E73, 0x0075, 0x0324}, {0x1E74, 0x0055, 0x0330},
+    {0x1E75, 0x0075, 0x0330}, {0x1E76, 0x0055, 0x032D}, {0x1E77, 0x0075, 0x032D}, {0x1E78, 0x0168, 0x0301},
+    {0x1E79, 0x0169, 0x0301}, {0x1E7A, 0x016A, 0x0308}, {0x1E7B, 0x016B, 0x0308}, {0x1E7C, 0x0056, 0x0303},
+    {0x1E7D, 0x0076, 0x0303}, {0x1E7E, 0x0056, 0x0323}, {0x1E7F, 0x0076, 0x0323}, {0x1E80, 0x0057, 0x0300},
+    {0x1E81, 0x0077, 0x0300}, {0x1E82, 0x0057, 0x0301}, {0x1E83, 0x0077, 0x0301}, {0x1E84, 0x0057, 0x0308},
+    {0x1E85, 0x0077, 0x0308}, {0x1E86, 0x0057, 0x0307}, {0x1E87, 0x0077, 0x0307}, {0x1E88, 0x0057, 0x0323},
+    {0x1E89, 0x0077, 0x0323}, {0x1E8A, 0x0058, 0x0307}, {0x1E8B, 0x0078, 0x0307}, {0x1E8C, 0x0058, 0x0308},
+    {0x1E8D, 0x0078, 0x0308}, {0x1E8E, 0x0059, 0x0307}, {0x1E8F, 0x0079, 0x0307}, {0x1E90, 0x005A, 0x0302},
+    {0x1E91, 0x007A, 0x0302}, {0x1E92, 0x005A, 0x0323}, {0x1E93, 0x007A, 0x0323}, {0x1E94, 0x005A, 0x0331},
+    {0x1E95, 0x007A, 0x0331}, {0x1E96, 0x0068, 0x0331}, {0x1E97, 0x0074, 0x0308}, {0x1E98, 0x0077, 0x030A},
+    {0x1E99, 0x0079, 0x030A}, {0x1E9B, 0x017F, 0x0307}, {0x1EA0, 0x0041, 0x0323}, {0x1EA1, 0x0061, 0x0323},
+    {0x1EA2, 0x0041, 0x0309}, {0x1EA3, 0x0061, 0x0309}, {0x1EA4, 0x00C2, 0x0301}, {0x1EA5, 0x00E2, 0x0301},
+    {0x1EA6, 0x00C2, 0x0300}, {0x1EA7, 0x00E2, 0x0300}, {0x1EA8, 0x00C2, 0x0309}, {0x1EA9, 0x00E2, 0x0309},
+    {0x1EAA, 0x00C2, 0x0303}, {0x1EAB, 0x00E2, 0x0303}, {0x1EAC, 0x1EA0, 0x0302}, {0x1EAD, 0x1EA1, 0x0302},
+    {0x1EAE, 0x0102, 0x0301}, {0x1EAF, 0x0103, 0x0301}, {0x1EB0, 0x0102, 0x0300}, {0x1EB1, 0x0103, 0x0300},
+    {0x1EB2, 0x0102, 0x0309}, {0x1EB3, 0x0103, 0x0309}, {0x1EB4, 0x0102, 0x0303}, {0x1EB5, 0x0103, 0x0303},
+    {0x1EB6, 0x1EA0, 0x0306}, {0x1EB7, 0x1EA1, 0x0306}, {0x1EB8, 0x0045, 0x0323}, {0x1EB9, 0x0065, 0x0323},
+    {0x1EBA, 0x0045, 0x0309}, {0x1EBB, 0x0065, 0x0309}, {0x1EBC, 0x0045, 0x0303}, {0x1EBD, 0x0065, 0x0303},
+    {0x1EBE, 0x00CA, 0x0301}, {0x1EBF, 0x00EA, 0x0301}, {0x1EC0, 0x00CA, 0x0300}, {0x1EC1, 0x00EA, 0x0300},
+    {0x1EC2, 0x00CA, 0x0309}, {0x1EC3, 0x00EA, 0x0309}, {0x1EC4, 0x00CA, 0x0303}, {0x1EC5, 0x00EA, 0x0303},
+    {0x1EC6, 0x1EB8, 0x0302}, {0x1EC7, 0x1EB9, 0x0302}, {0x1EC8, 0x0049, 0x0309}, {0x1EC9, 0x0069, 0x0309},
+    {0x1ECA, 0x0049, 0x0323}, {0x1ECB, 0x0069, 0x0323}, {0x1ECC, 0x004F, 0x0323}, {0x1ECD, 0x006F, 0x0323},
+    {0x1ECE, 0x004F, 0x0309}, {0x1ECF, 0x006F, 0x0309}, {0x1ED0, 0x00D4, 0x0301}, {0x1ED1, 0x00F4, 0x0301},
+    {0x1ED2, 0x00D4, 0x0300}, {0x1ED3, 0x00F4, 0x0300}, {0x1ED4, 0x00D4, 0x0309}, {0x1ED5, 0x00F4, 0x0309},
+    {0x1ED6, 0x00D4, 0x0303}, {0x1ED7, 0x00F4, 0x0303}, {0x1ED8, 0x1ECC, 0x0302}, {0x1ED9, 0x1ECD, 0x0302},
+    {0x1EDA, 0x01A0, 0x0301}, {0x1EDB, 0x01A1, 0x0301}, {0x1EDC, 0x01A0, 0x0300}, {0x1EDD, 0x01A1, 0x0300},
+    {0x1EDE, 0x01A0, 0x0309}, {0x1EDF, 0x01A1, 0x0309}, {0x1EE0, 0x01A0, 0x0303}, {0x1EE1, 0x01A1, 0x0303},
+    {0x1EE2, 0x01A0, 0x0323}, {0x1EE3, 0x01A1, 0x0323}, {0x1EE4, 0x0055, 0x0323}, {0x1EE5, 0x0075, 0x0323},
+    {0x1EE6, 0x0055, 0x0309}, {0x1EE7, 0x0075, 0x0309}, {0x1EE8, 0x01AF, 0x0301}, {0x1EE9, 0x01B0, 0x0301},
+    {0x1EEA, 0x01AF, 0x0300}, {0x1EEB, 0x01B0, 0x0300}, {0x1EEC, 0x01AF, 0x0309}, {0x1EED, 0x01B0, 0x0309},
+    {0x1EEE, 0x01AF, 0x0303}, {0x1EEF, 0x01B0, 0x0303}, {0x1EF0, 0x01AF, 0x0323}, {0x1EF1, 0x01B0, 0x0323},
+    {0x1EF2, 0x0059, 0x0300}, {0x1EF3, 0x0079, 0x0300}, {0x1EF4, 0x0059, 0x0323}, {0x1EF5, 0x0079, 0x0323},
+    {0x1EF6, 0x0059, 0x0309}, {0x1EF7, 0x0079, 0x0309}, {0x1EF8, 0x0059, 0x0303}, {0x1EF9, 0x0079, 0x0303},
+    {0x1F00, 0x03B1, 0x0313}, {0x1F01, 0x03B1, 0x0314}, {0x1F02, 0x1F00, 0x0300}, {0x1F03, 0x1F01, 0x0300},
+    {0x1F04, 0x1F00, 0x0301}, {0x1F05, 0x1F01, 0x0301}, {0x1F06, 0x1F00, 0x0342}, {0x1F07, 0x1F01, 0x0342},
+    {0x1F08, 0x0391, 0x0313}, {0x1F09, 0x0391, 0x0314}, {0x1F0A, 0x1F08, 0x0300}, {0x1F0B, 0x1F09, 0x0300},
+    {0x1F0C, 0x1F08, 0x0301}, {0x1F0D, 0x1F09, 0x0301}, {0x1F0E, 0x1F08, 0x0342}, {0x1F0F, 0x1F09, 0x0342},
+    {0x1F10, 0x03B5, 0x0313}, {0x1F11, 0x03B5, 0x0314}, {0x1F12, 0x1F10, 0x0300}, {0x1F13, 0x1F11, 0x0300},
+    {0x1F14, 0x1F10, 0x0301}, {0x1F15, 0x1F11, 0x0301}, {0x1F18, 0x0395, 0x0313}, {0x1F19, 0x0395, 0x0314},
+    {0x1F1A, 0x1F18, 0x0300}, {0x1F1B, 0x1F19, 0x0300}, {0x1F1C, 0x1F18, 0x0301}, {0x1F1D, 0x1F19, 0x0301},
+    {0x1F20, 0x03B7, 0x0313}, {0x1F21, 0x03B7, 0x0314}, {0x1F22, 0x1F20, 0x0300}, {0x1F23, 0x1F21, 0x0300},
+    {0x1F24, 0x1F20, 0x0301}, {0x1F25, 0x1F21, 0x0301}, {0x1F26, 0x1F20, 0x0342}, {0x1F27, 0x1F21, 0x0342},
+    {0x1F28, 0x0397, 0x0313}, {0x1F29, 0x0397, 0x0314}, {0x1F2A, 0x1F28, 0x0300}, {0x1F2B, 0x1F29, 0x0300},
+    {0x1F2C, 0x1F28, 0x0301}, {0x1F2D, 0x1F29, 0x0301}, {0x1F2E, 0x1F28, 0x0342}, {0x1F2F, 0x1F29, 0x0342},
+    {0x1F30, 0x03B9, 0x0313}, {0x1F31, 0x03B9, 0x0314}, {0x1F32, 0x1F30, 0x0300}, {0x1F33, 0x1F31, 0x0300},
+    {0x1F34, 0x1F30, 0x0301}, {0x1F35, 0x1F31, 0x0301}, {0x1F36, 0x1F30, 0x0342}, {0x1F37, 0x1F31, 0x0342},
+    {0x1F38, 0x0399, 0x0313}, {0x1F39, 0x0399, 0x0314}, {0x1F3A, 0x1F38, 0x0300}, {0x1F3B, 0x1F39, 0x0300},
+    {0x1F3C, 0x1F38, 0x0301}, {0x1F3D, 0x1F39, 0x0301}, {0x1F3E, 0x1F38, 0x0342}, {0x1F3F, 0x1F39, 0x0342},
+    {0x1F40, 0x03BF, 0x0313}, {0x1F41, 0x03BF, 0x0314}, {0x1F42, 0x1F40, 0x0300}, {0x1F43, 0x1F41, 0x0300},
+    {0x1F44, 0x1F40, 0x0301}, {0x1F45, 0x1F41, 0x0301}, {0x1F48, 0x039F, 0x0313}, {0x1F49, 0x039F, 0x0314},
+    {0x1F4A, 0x1F48, 0x0300}, {0x1F4B, 0x1F49, 0x0300}, {0x1F4C, 0x1F48, 0x0301}, {0x1F4D, 0x1F49, 0x0301},
+    {0x1F50, 0x03C5, 0x0313}, {0x1F51, 0x03C5, 0x0314}, {0x1F52, 0x1F50, 0x0300}, {0x1F53, 0x1F51, 0x0300},
+    {0x1F54, 0x1F50, 0x0301}, {0x1F55, 0x1F51, 0x0301}, {0x1F56, 0x1F50, 0x0342}, {0x1F57, 0x1F51, 0x0342},
+    {0x1F59, 0x03A5, 0x0314}, {0x1F5B, 0x1F59, 0x0300}, {0x1F5D, 0x1F59, 0x0301}, {0x1F5F, 0x1F59, 0x0342},
+    {0x1F60, 0x03C9, 0x0313}, {0x1F61, 0x03C9, 0x0314}, {0x1F62, 0x1F60, 0x0300}, {0x1F63, 0x1F61, 0x0300},
+    {0x1F64, 0x1F60, 0x0301}, {0x1F65, 0x1F61, 0x0301}, {0x1F66, 0x1F60, 0x0342}, {0x1F67, 0x1F61, 0x0342},
+    {0x1F68, 0x03A9, 0x0313}, {0x1F69, 0x03A9, 0x0314}, {0x1F6A, 0x1F68, 0x0300}, {0x1F6B, 0x1F69, 0x0300},
+    {0x1F6C, 0x1F68, 0x0301}, {0x1F6D, 0x1F69, 0x0301}, {0x1F6E, 0x1F68, 0x0342}, {0x1F6F, 0x1F69, 0x0342},
+    {0x1F70, 0x03B1, 0x0300}, {0x1F71, 0x03AC, 0x0000}, {0x1F72, 0x03B5, 0x0300}, {0x1F73, 0x03AD, 0x0000},
+    {0x1F74, 0x03B7, 0x0300}, {0x1F75, 0x03AE, 0x0000}, {0x1F76, 0x03B9, 0x0300}, {0x1F77, 0x03AF, 0x0000},
+    {0x1F78, 0x03BF, 0x0300}, {0x1F79, 0x03CC, 0x0000}, {0x1F7A, 0x03C5, 0x0300}, {0x1F7B, 0x03CD, 0x0000},
+    {0x1F7C, 0x03C9, 0x0300}, {0x1F7D, 0x03CE, 0x0000}, {0x1F80, 0x1F00, 0x0345}, {0x1F81, 0x1F01, 0x0345},
+    {0x1F82, 0x1F02, 0x0345}, {0x1F83, 0x1F03, 0x0345}, {0x1F84, 0x1F04, 0x0345}, {0x1F85, 0x1F05, 0x0345},
+    {0x1F86, 0x1F06, 0x0345}, {0x1F87, 0x1F07, 0x0345}, {0x1F88, 0x1F08, 0x0345}, {0x1F89, 0x1F09, 0x0345},
+    {0x1F8A, 0x1F0A, 0x0345}, {0x1F8B, 0x1F0B, 0x0345}, {0x1F8C, 0x1F0C, 0x0345}, {0x1F8D, 0x1F0D, 0x0345},
+    {0x1F8E, 0x1F0E, 0x0345}, {0x1F8F, 0x1F0F, 0x0345}, {0x1F90, 0x1F20, 0x0345}, {0x1F91, 0x1F21, 0x0345},
+    {0x1F92, 0x1F22, 0x0345}, {0x1F93, 0x1F23, 0x0345}, {0x1F94, 0x1F24, 0x0345}, {0x1F95, 0x1F25, 0x0345},
+    {0x1F96, 0x1F26, 0x0345}, {0x1F97, 0x1F27, 0x0345}, {0x1F98, 0x1F28, 0x0345}, {0x1F99, 0x1F29, 0x0345},
+    {0x1F9A, 0x1F2A, 0x0345}, {0x1F9B, 0x1F2B, 0x0345}, {0x1F9C, 0x1F2C, 0x0345}, {0x1F9D, 0x1F2D, 0x0345},
+    {0x1F9E, 0x1F2E, 0x0345}, {0x1F9F, 0x1F2F, 0x0345}, {0x1FA0, 0x1F60, 0x0345}, {0x1FA1, 0x1F61, 0x0345},
+    {0x1FA2, 0x1F62, 0x0345}, {0x1FA3, 0x1F63, 0x0345}, {0x1FA4, 0x1F64, 0x0345}, {0x1FA5, 0x1F65, 0x0345},
+    {0x1FA6, 0x1F66, 0x0345}, {0x1FA7, 0x1F67, 0x0345}, {0x1FA8, 0x1F68, 0x0345}, {0x1FA9, 0x1F69, 0x0345},
+    {0x1FAA, 0x1F6A, 0x0345}, {0x1FAB, 0x1F6B, 0x0345}, {0x1FAC, 0x1F6C, 0x0345}, {0x1FAD, 0x1F6D, 0x0345},
+    {0x1FAE, 0x1F6E, 0x0345}, {0x1FAF, 0x1F6F, 0x0345}, {0x1FB0, 0x03B1, 0x0306}, {0x1FB1, 0x03B1, 0x0304},
+    {0x1FB2, 0x1F70, 0x0345}, {0x1FB3, 0x03B1, 0x0345}, {0x1FB4, 0x03AC, 0x0345}, {0x1FB6, 0x03B1, 0x0342},
+    {0x1FB7, 0x1FB6, 0x0345}, {0x1FB8, 0x0391, 0x0306}, {0x1FB9, 0x0391, 0x0304}, {0x1FBA, 0x0391, 0x0300},
+    {0x1FBB, 0x0386, 0x0000}, {0x1FBC, 0x0391, 0x0345}, {0x1FBE, 0x03B9, 0x0000}, {0x1FC1, 0x00A8, 0x0342},
+    {0x1FC2, 0x1F74, 0x0345}, {0x1FC3, 0x03B7, 0x0345}, {0x1FC4, 0x03AE, 0x0345}, {0x1FC6, 0x03B7, 0x0342},
+    {0x1FC7, 0x1FC6, 0x0345}, {0x1FC8, 0x0395, 0x0300}, {0x1FC9, 0x0388, 0x0000}, {0x1FCA, 0x0397, 0x0300},
+    {0x1FCB, 0x0389, 0x0000}, {0x1FCC, 0x0397, 0x0345}, {0x1FCD, 0x1FBF, 0x0300}, {0x1FCE, 0x1FBF, 0x0301},
+    {0x1FCF, 0x1FBF, 0x0342}, {0x1FD0, 0x03B9, 0x0306}, {0x1FD1, 0x03B9, 0x0304}, {0x1FD2, 0x03CA, 0x0300},
+    {0x1FD3, 0x0390, 0x0000}, {0x1FD6, 0x03B9, 0x0342}, {0x1FD7, 0x03CA, 0x0342}, {0x1FD8, 0x0399, 0x0306},
+    {0x1FD9, 0x0399, 0x0304}, {0x1FDA, 0x0399, 0x0300}, {0x1FDB, 0x038A, 0x0000}, {0x1FDD, 0x1FFE, 0x0300},
+    {0x1FDE, 0x1FFE, 0x0301}, {0x1FDF, 0x1FFE, 0x0342}, {0x1FE0, 0x03C5, 0x0306}, {0x1FE1, 0x03C5, 0x0304},
+    {0x1FE2, 0x03CB, 0x0300}, {0x1FE3, 0x03B0, 0x0000}, {0x1FE4, 0x03C1, 0x0313}, {0x1FE5, 0x03C1, 0x0314},
+    {0x1FE6, 0x03C5, 0x0342}, {0x1FE7, 0x03CB, 0x0342}, {0x1FE8, 0x03A5, 0x0306}, {0x1FE9, 0x03A5, 0x0304},
+    {0x1FEA, 0x03A5, 0x0300}, {0x1FEB, 0x038E, 0x0000}, {0x1FEC, 0x03A1, 0x0314}, {0x1FED, 0x00A8, 0x0300},
+    {0x1FEE, 0x0385, 0x0000}, {0x1FEF, 0x0060, 0x0000}, {0x1FF2, 0x1F7C, 0x0345}, {0x1FF3, 0x03C9, 0x0345},
+    {0x1FF4, 0x03CE, 0x0345}, {0x1FF6, 0x03C9, 0x0342}, {0x1FF7, 0x1FF6, 0x0345}, {0x1FF8, 0x039F, 0x0300},
+    {0x1FF9, 0x038C, 0x0000}, {0x1FFA, 0x03A9, 0x0300}, {0x1FFB, 0x038F, 0x0000}, {0x1FFC, 0x03A9, 0x0345},
+    {0x1FFD, 0x00B4, 0x0000}, {0x2000, 0x2002, 0x0000}, {0x2001, 0x2003, 0x0000}, {0x2126, 0x03A9, 0x0000},
+    {0x212A, 0x004B, 0x0000}, {0x212B, 0x00C5, 0x0000}, {0x219A, 0x2190, 0x0338}, {0x219B, 0x2192, 0x0338},
+    {0x21AE, 0x2194, 0x0338}, {0x21CD, 0x21D0, 0x0338}, {0x21CE, 0x21D4, 0x0338}, {0x21CF, 0x21D2, 0x0338},
+    {0x2204, 0x2203, 0x0338}, {0x2209, 0x2208, 0x0338}, {0x220C, 0x220B, 0x0338}, {0x2224, 0x2223, 0x0338},
+    {0x2226, 0x2225, 0x0338}, {0x2241, 0x223C, 0x0338}, {0x2244, 0x2243, 0x0338}, {0x2247, 0x2245, 0x0338},
+    {0x2249, 0x2248, 0x0338}, {0x2260, 0x003D, 0x0338}, {0x2262, 0x2261, 0x0338}, {0x226D, 0x224D, 0x0338},
+    {0x226E, 0x003C, 0x0338}, {0x226F, 0x003E, 0x0338}, {0x2270, 0x2264, 0x0338}, {0x2271, 0x2265, 0x0338},
+    {0x2274, 0x2272, 0x0338}, {0x2275, 0x2273, 0x0338}, {0x2278, 0x2276, 0x0338}, {0x2279, 0x2277, 0x0338},
+    {0x2280, 0x227A, 0x0338}, {0x2281, 0x227B, 0x0338}, {0x2284, 0x2282, 0x0338}, {0x2285, 0x2283, 0x0338},
+    {0x2288, 0x2286, 0x0338}, {0x2289, 0x2287, 0x0338}, {0x22AC, 0x22A2, 0x0338}, {0x22AD, 0x22A8, 0x0338},
+    {0x22AE, 0x22A9, 0x0338}, {0x22AF, 0x22AB, 0x0338}, {0x22E0, 0x227C, 0x0338}, {0x22E1, 0x227D, 0x0338},
+    {0x22E2, 0x2291, 0x0338}, {0x22E3, 0x2292, 0x0338}, {0x22EA, 0x22B2, 0x0338}, {0x22EB, 0x22B3, 0x0338},
+    {0x22EC, 0x22B4, 0x0338}, {0x22ED, 0x22B5, 0x0338}, {0x2329, 0x3008, 0x0000}, {0x232A, 0x3009, 0x0000},
+    {0x2ADC, 0x2ADD, 0x0338}, {0x304C, 0x304B, 0x3099}, {0x304E, 0x304D, 0x3099}, {0x3050, 0x304F, 0x3099},
+    {0x3052, 0x3051, 0x3099}, {0x3054, 0x3053, 0x3099}, {0x3056, 0x3055, 0x3099}, {0x3058, 0x3057, 0x3099},
+    {0x305A, 0x3059, 0x3099}, {0x305C, 0x305B, 0x3099}, {0x305E, 0x305D, 0x3099}, {0x3060, 0x305F, 0x3099},
+    {0x3062, 0x3061, 0x3099}, {0x3065, 0x3064, 0x3099}, {0x3067, 0x3066, 0x3099}, {0x3069, 0x3068, 0x3099},
+    {0x3070, 0x306F, 0x3099}, {0x3071, 0x306F, 0x309A}, {0x3073, 0x3072, 0x3099}, {0x3074, 0x3072, 0x309A},
+    {0x3076, 0x3075, 0x3099}, {0x3077, 0x3075, 0x309A}, {0x3079, 0x3078, 0x3099}, {0x307A, 0x3078, 0x309A},
+    {0x307C, 0x307B, 0x3099}, {0x307D, 0x307B, 0x309A}, {0x3094, 0x3046, 0x3099}, {0x309E, 0x309D, 0x3099},
+    {0x30AC, 0x30AB, 0x3099}, {0x30AE, 0x30AD, 0x3099}, {0x30B0, 0x30AF, 0x3099}, {0x30B2, 0x30B1, 0x3099},
+    {0x30B4, 0x30B3, 0x3099}, {0x30B6, 0x30B5, 0x3099}, {0x30B8, 0x30B7, 0x3099}, {0x30BA, 0x30B9, 0x3099},
+    {0x30BC, 0x30BB, 0x3099}, {0x30BE, 0x30BD, 0x3099}, {0x30C0, 0x30BF, 0x3099}, {0x30C2, 0x30C1, 0x3099},
+    {0x30C5, 0x30C4, 0x3099}, {0x30C7, 0x30C6, 0x3099}, {0x30C9, 0x30C8, 0x3099}, {0x30D0, 0x30CF, 0x3099},
+    {0x30D1, 0x30CF, 0x309A}, {0x30D3, 0x30D2, 0x3099}, {0x30D4, 0x30D2, 0x309A}, {0x30D6, 0x30D5, 0x3099},
+    {0x30D7, 0x30D5, 0x309A}, {0x30D9, 0x30D8, 0x3099}, {0x30DA, 0x30D8, 0x309A}, {0x30DC, 0x30DB, 0x3099},
+    {0x30DD, 0x30DB, 0x309A}, {0x30F4, 0x30A6, 0x3099}, {0x30F7, 0x30EF, 0x3099}, {0x30F8, 0x30F0, 0x3099},
+    {0x30F9, 0x30F1, 0x3099}, {0x30FA, 0x30F2, 0x3099}, {0x30FE, 0x30FD, 0x3099}, {0xF900, 0x8C48, 0x0000},
+    {0xF901, 0x66F4, 0x0000}, {0xF902, 0x8ECA, 0x0000}, {0xF903, 0x8CC8, 0x0000}, {0xF904, 0x6ED1, 0x0000},
+    {0xF905, 0x4E32, 0x0000}, {0xF906, 0x53E5, 0x0000}, {0xF907, 0x9F9C, 0x0000}, {0xF908, 0x9F9C, 0x0000},
+    {0xF909, 0x5951, 0x0000}, {0xF90A, 0x91D1, 0x0000}, {0xF90B, 0x5587, 0x0000}, {0xF90C, 0x5948, 0x0000},
+    {0xF90D, 0x61F6, 0x0000}, {0xF90E, 0x7669, 0x0000}, {0xF90F, 0x7F85, 0x0000}, {0xF910, 0x863F, 0x0000},
+    {0xF911, 0x87BA, 0x0000}, {0xF912, 0x88F8, 0x0000}, {0xF913, 0x908F, 0x0000}, {0xF914, 0x6A02, 0x0000},
+    {0xF915, 0x6D1B, 0x0000}, {0xF916, 0x70D9, 0x0000}, {0xF917, 0x73DE, 0x0000}, {0xF918, 0x843D, 0x0000},
+    {0xF919, 0x916A, 0x0000}, {0xF91A, 0x99F1, 0x0000}, {0xF91B, 0x4E82, 0x0000}, {0xF91C, 0x5375, 0x0000},
+    {0xF91D, 0x6B04, 0x0000}, {0xF91E, 0x721B, 0x0000}, {0xF91F, 0x862D, 0x0000}, {0xF920, 0x9E1E, 0x0000},
+    {0xF921, 0x5D50, 0x0000}, {0xF922, 0x6FEB, 0x0000}, {0xF923, 0x85CD, 0x0000}, {0xF924, 0x8964, 0x0000},
+    {0xF925, 0x62C9, 0x0000}, {0xF926, 0x81D8, 0x0000}, {0xF927, 0x881F, 0x0000}, {0xF928, 0x5ECA, 0x0000},
+    {0xF929, 0x6717, 0x0000}, {0xF92A, 0x6D6A, 0x0000}, {0xF92B, 0x72FC, 0x0000}, {0xF92C, 0x90CE, 0x0000},
+    {0xF92D, 0x4F86, 0x0000}, {0xF92E, 0x51B7, 0x0000}, {0xF92F, 0x52DE, 0x0000}, {0xF930, 0x64C4, 0x0000},
+    {0xF931, 0x6AD3, 0x0000}, {0xF932, 0x7210, 0x0000}, {0xF933, 0x76E7, 0x0000}, {0xF934, 0x8001, 0x0000},
+    {0xF935, 0x8606, 0x0000}, {0xF936, 0x865C, 0x0000}, {0xF937, 0x8DEF, 0x0000}, {0xF938, 0x9732, 0x0000},
+    {0xF939, 0x9B6F, 0x0000}, {0xF93A, 0x9DFA, 0x0000}, {0xF93B, 0x788C, 0x0000}, {0xF93C, 0x797F, 0x0000},
+    {0xF93D, 0x7DA0, 0x0000}, {0xF93E, 0x83C9, 0x0000}, {0xF93F, 0x9304, 0x0000}, {0xF940, 0x9E7F, 0x0000},
+    {0xF941, 0x8AD6, 0x0000}, {0xF942, 0x58DF, 0x0000}, {0xF943, 0x5F04, 0x0000}, {0xF944, 0x7C60, 0x0000},
+    {0xF945, 0x807E, 0x0000}, {0xF946, 0x7262, 0x0000}, {0xF947, 0x78CA, 0x0000}, {0xF948, 0x8CC2, 0x0000},
+    {0xF949, 0x96F7, 0x0000}, {0xF94A, 0x58D8, 0x0000}, {0xF94B, 0x5C62, 0x0000}, {0xF94C, 0x6A13, 0x0000},
+    {0xF94D, 0x6DDA, 0x0000}, {0xF94E, 0x6F0F, 0x0000}, {0xF94F, 0x7D2F, 0x0000}, {0xF950, 0x7E37, 0x0000},
+    {0xF951, 0x964B, 0x0000}, {0xF952, 0x52D2, 0x0000}, {0xF953, 0x808B, 0x0000}, {0xF954, 0x51DC, 0x0000},
+    {0xF955, 0x51CC, 0x0000}, {0xF956, 0x7A1C, 0x0000}, {0xF957, 0x7DBE, 0x0000}, {0xF958, 0x83F1, 0x0000},
+    {0xF959, 0x9675, 0x0000}, {0xF95A, 0x8B80, 0x0000}, {0xF95B, 0x62CF, 0x0000}, {0xF95C, 0x6A02, 0x0000},
+    {0xF95D, 0x8AFE, 0x0000}, {0xF95E, 0x4E39, 0x0000}, {0xF95F, 0x5BE7, 0x0000}, {0xF960, 0x6012, 0x0000},
+    {0xF961, 0x7387, 0x0000}, {0xF962, 0x7570, 0x0000}, {0xF963, 0x5317, 0x0000}, {0xF964, 0x78FB, 0x0000},
+    {0xF965, 0x4FBF, 0x0000}, {0xF966, 0x5FA9, 0x0000}, {0xF967, 0x4E0D, 0x0000}, {0xF968, 0x6CCC, 0x0000},
+    {0xF969, 0x6578, 0x0000}, {0xF96A, 0x7D22, 0x0000}, {0xF96B, 0x53C3, 0x0000}, {0xF96C, 0x585E, 0x0000},
+    {0xF96D, 0x7701, 0x0000}, {0xF96E, 0x8449, 0x0000}, {0xF96F, 0x8AAA, 0x0000}, {0xF970, 0x6BBA, 0x0000},
+    {0xF971, 0x8FB0, 0x0000}, {0xF972, 0x6C88, 0x0000}, {0xF973, 0x62FE, 0x0000}, {0xF974, 0x82E5, 0x0000},
+    {0xF975, 0x63A0, 0x0000}, {0xF976, 0x7565, 0x0000}, {0xF977, 0x4EAE, 0x0000}, {0xF978, 0x5169, 0x0000},
+    {0xF979, 0x51C9, 0x0000}, {0xF97A, 0x6881, 0x0000}, {0xF97B, 0x7CE7, 0x0000}, {0xF97C, 0x826F, 0x0000},
+    {0xF97D, 0x8AD2, 0x0000}, {0xF97E, 0x91CF, 0x0000}, {0xF97F, 0x52F5, 0x0000}, {0xF980, 0x5442, 0x0000},
+    {0xF981, 0x5973, 0x0000}, {0xF982, 0x5EEC, 0x0000}, {0xF983, 0x65C5, 0x0000}, {0xF984, 0x6FFE, 0x0000},
+    {0xF985, 0x792A, 0x0000}, {0xF986, 0x95AD, 0x0000}, {0xF987, 0x9A6A, 0x0000}, {0xF988, 0x9E97, 0x0000},
+    {0xF989, 0x9ECE, 0x0000}, {0xF98A, 0x529B, 0x0000}, {0xF98B, 0x66C6, 0x0000}, {0xF98C, 0x6B77, 0x0000},
+    {0xF98D, 0x8F62, 0x0000}, {0xF98E, 0x5E74, 0x0000}, {0xF98F, 0x6190, 0x0000}, {0xF990, 0x6200, 0x0000},
+    {0xF991, 0x649A, 0x0000}, {0xF992, 0x6F23, 0x0000}, {0xF993, 0x7149, 0x0000}, {0xF994, 0x7489, 0x0000},
+    {0xF995, 0x79CA, 0x0000}, {0xF996, 0x7DF4, 0x0000}, {0xF997, 0x806F, 0x0000}, {0xF998, 0x8F26, 0x0000},
+    {0xF999, 0x84EE, 0x0000}, {0xF99A, 0x9023, 0x0000}, {0xF99B, 0x934A, 0x0000}, {0xF99C, 0x5217, 0x0000},
+    {0xF99D, 0x52A3, 0x0000}, {0xF99E, 0x54BD, 0x0000}, {0xF99F, 0x70C8, 0x0000}, {0xF9A0, 0x88C2, 0x0000},
+    {0xF9A1, 0x8AAA, 0x0000}, {0xF9A2, 0x5EC9, 0x0000}, {0xF9A3, 0x5FF5, 0x0000}, {0xF9A4, 0x637B, 0x0000},
+    {0xF9A5, 0x6BAE, 0x0000}, {0xF9A6, 0x7C3E, 0x0000}, {0xF9A7, 0x7375, 0x0000}, {0xF9A8, 0x4EE4, 0x0000},
+    {0xF9A9, 0x56F9, 0x0000}, {0xF9AA, 0x5BE7, 0x0000}, {0xF9AB, 0x5DBA, 0x0000}, {0xF9AC, 0x601C, 0x0000},
+    {0xF9AD, 0x73B2, 0x0000}, {0xF9AE, 0x7469, 0x0000}, {0xF9AF, 0x7F9A, 0x0000}, {0xF9B0, 0x8046, 0x0000},
+    {0xF9B1, 0x9234, 0x0000}, {0xF9B2, 0x96F6, 0x0000}, {0xF9B3, 0x9748, 0x0000}, {0xF9B4, 0x9818, 0x0000},
+    {0xF9B5, 0x4F8B, 0x0000}, {0xF9B6, 0x79AE, 0x0000}, {0xF9B7, 0x91B4, 0x0000}, {0xF9B8, 0x96B8, 0x0000},
+    {0xF9B9, 0x60E1, 0x0000}, {0xF9BA, 0x4E86, 0x0000}, {0xF9BB, 0x50DA, 0x0000}, {0xF9BC, 0x5BEE, 0x0000},
+    {0xF9BD, 0x5C3F, 0x0000}, {0xF9BE, 0x6599, 0x0000}, {0xF9BF, 0x6A02, 0x0000}, {0xF9C0, 0x71CE, 0x0000},
+    {0xF9C1, 0x7642, 0x0000}, {0xF9C2, 0x84FC, 0x0000}, {0xF9C3, 0x907C, 0x0000}, {0xF9C4, 0x9F8D, 0x0000},
+    {0xF9C5, 0x6688, 0x0000}, {0xF9C6, 0x962E, 0x0000}, {0xF9C7, 0x5289, 0x0000}, {0xF9C8, 0x677B, 0x0000},
+    {0xF9C9, 0x67F3, 0x0000}, {0xF9CA, 0x6D41, 0x0000}, {0xF9CB, 0x6E9C, 0x0000}, {0xF9CC, 0x7409, 0x0000},
+    {0xF9CD, 0x7559, 0x0000}, {0xF9CE, 0x786B, 0x0000}, {0xF9CF, 0x7D10, 0x0000}, {0xF9D0, 0x985E, 0x0000},
+    {0xF9D1, 0x516D, 0x0000}, {0xF9D2, 0x622E, 0x0000}, {0xF9D3, 0x9678, 0x0000}, {0xF9D4, 0x502B, 0x0000},
+    {0xF9D5, 0x5D19, 0x0000}, {0xF9D6, 0x6DEA, 0x0000}, {0xF9D7, 0x8F2A, 0x0000}, {0xF9D8, 0x5F8B, 0x0000},
+    {0xF9D9, 0x6144, 0x0000}, {0xF9DA, 0x6817, 0x0000}, {0xF9DB, 0x7387, 0x0000}, {0xF9DC, 0x9686, 0x0000},
+    {0xF9DD, 0x5229, 0x0000}, {0xF9DE, 0x540F, 0x0000}, {0xF9DF, 0x5C65, 0x0000}, {0xF9E0, 0x6613, 0x0000},
+    {0xF9E1, 0x674E, 0x0000}, {0xF9E2, 0x68A8, 0x0000}, {0xF9E3, 0x6CE5, 0x0000}, {0xF9E4, 0x7406, 0x0000},
+    {0xF9E5, 0x75E2, 0x0000}, {0xF9E6, 0x7F79, 0x0000}, {0xF9E7, 0x88CF, 0x0000}, {0xF9E8, 0x88E1, 0x0000},
+    {0xF9E9, 0x91CC, 0x0000}, {0xF9EA, 0x96E2, 0x0000}, {0xF9EB, 0x533F, 0x0000}, {0xF9EC, 0x6EBA, 0x0000},
+    {0xF9ED, 0x541D, 0x0000}, {0xF9EE, 0x71D0, 0x0000}, {0xF9EF, 0x7498, 0x0000}, {0xF9F0, 0x85FA, 0x0000},
+    {0xF9F1, 0x96A3, 0x0000}, {0xF9F2, 0x9C57, 0x0000}, {0xF9F3, 0x9E9F, 0x0000}, {0xF9F4, 0x6797, 0x0000},
+    {0xF9F5, 0x6DCB, 0x0000}, {0xF9F6, 0x81E8, 0x0000}, {0xF9F7, 0x7ACB, 0x0000}, {0xF9F8, 0x7B20, 0x0000},
+    {0xF9F9, 0x7C92, 0x0000}, {0xF9FA, 0x72C0, 0x0000}, {0xF9FB, 0x7099, 0x0000}, {0xF9FC, 0x8B58, 0x0000},
+    {0xF9FD, 0x4EC0, 0x0000}, {0xF9FE, 0x8336, 0x0000}, {0xF9FF, 0x523A, 0x0000}, {0xFA00, 0x5207, 0x0000},
+    {0xFA01, 0x5EA6, 0x0000}, {0xFA02, 0x62D3, 0x0000}, {0xFA03, 0x7CD6, 0x0000}, {0xFA04, 0x5B85, 0x0000},
+    {0xFA05, 0x6D1E, 0x0000}, {0xFA06, 0x66B4, 0x0000}, {0xFA07, 0x8F3B, 0x0000}, {0xFA08, 0x884C, 0x0000},
+    {0xFA09, 0x964D, 0x0000}, {0xFA0A, 0x898B, 0x0000}, {0xFA0B, 0x5ED3, 0x0000}, {0xFA0C, 0x5140, 0x0000},
+    {0xFA0D, 0x55C0, 0x0000}, {0xFA10, 0x585A, 0x0000}, {0xFA12, 0x6674, 0x0000}, {0xFA15, 0x51DE, 0x0000},
+    {0xFA16, 0x732A, 0x0000}, {0xFA17, 0x76CA, 0x0000}, {0xFA18, 0x793C, 0x0000}, {0xFA19, 0x795E, 0x0000},
+    {0xFA1A, 0x7965, 0x0000}, {0xFA1B, 0x798F, 0x0000}, {0xFA1C, 0x9756, 0x0000}, {0xFA1D, 0x7CBE, 0x0000},
+    {0xFA1E, 0x7FBD, 0x0000}, {0xFA20, 0x8612, 0x0000}, {0xFA22, 0x8AF8, 0x0000}, {0xFA25, 0x9038, 0x0000},
+    {0xFA26, 0x90FD, 0x0000}, {0xFA2A, 0x98EF, 0x0000}, {0xFA2B, 0x98FC, 0x0000}, {0xFA2C, 0x9928, 0x0000},
+    {0xFA2D, 0x9DB4, 0x0000}, {0xFA2E, 0x90DE, 0x0000}, {0xFA2F, 0x96B7, 0x0000}, {0xFA30, 0x4FAE, 0x0000},
+    {0xFA31, 0x50E7, 0x0000}, {0xFA32, 0x514D, 0x0000}, {0xFA33, 0x52C9, 0x0000}, {0xFA34, 0x52E4, 0x0000},
+    {0xFA35, 0x5351, 0x0000}, {0xFA36, 0x559D, 0x0000}, {0xFA37, 0x5606, 0x0000}, {0xFA38, 0x5668, 0x0000},
+    {0xFA39, 0x5840, 0x0000}, {0xFA3A, 0x58A8, 0x0000}, {0xFA3B, 0x5C64, 0x0000}, {0xFA3C, 0x5C6E, 0x0000},
+    {0xFA3D, 0x6094, 0x0000}, {0xFA3E, 0x6168, 0x0000}, {0xFA3F, 0x618E, 0x0000}, {0xFA40, 0x61F2, 0x0000},
+    {0xFA41, 0x654F, 0x0000}, {0xFA42, 0x65E2, 0x0000}, {0xFA43, 0x6691, 0x0000}, {0xFA44, 0x6885, 0x0000},
+    {0xFA45, 0x6D77, 0x0000}, {0xFA46, 0x6E1A, 0x0000}, {0xFA47, 0x6F22, 0x0000}, {0xFA48, 0x716E, 0x0000},
+    {0xFA49, 0x722B, 0x0000}, {0xFA4A, 0x7422, 0x0000}, {0xFA4B, 0x7891, 0x0000}, {0xFA4C, 0x793E, 0x0000},
+    {0xFA4D, 0x7949, 0x0000}, {0xFA4E, 0x7948, 0x0000}, {0xFA4F, 0x7950, 0x0000}, {0xFA50, 0x7956, 0x0000},
+    {0xFA51, 0x795D, 0x0000}, {0xFA52, 0x798D, 0x0000}, {0xFA53, 0x798E, 0x0000}, {0xFA54, 0x7A40, 0x0000},
+    {0xFA55, 0x7A81, 0x0000}, {0xFA56, 0x7BC0, 0x0000}, {0xFA57, 0x7DF4, 0x0000}, {0xFA58, 0x7E09, 0x0000},
+    {0xFA59, 0x7E41, 0x0000}, {0xFA5A, 0x7F72, 0x0000}, {0xFA5B, 0x8005, 0x0000}, {0xFA5C, 0x81ED, 0x0000},
+    {0xFA5D, 0x8279, 0x0000}, {0xFA5E, 0x8279, 0x0000}, {0xFA5F, 0x8457, 0x0000}, {0xFA60, 0x8910, 0x0000},
+    {0xFA61, 0x8996, 0x0000}, {0xFA62, 0x8B01, 0x0000}, {0xFA63, 0x8B39, 0x0000}, {0xFA64, 0x8CD3, 0x0000},
+    {0xFA65, 0x8D08, 0x0000}, {0xFA66, 0x8FB6, 0x0000}, {0xFA67, 0x9038, 0x0000}, {0xFA68, 0x96E3, 0x0000},
+    {0xFA69, 0x97FF, 0x0000}, {0xFA6A, 0x983B, 0x0000}, {0xFA6B, 0x6075, 0x0000}, {0xFA6C, 0x242EE, 0x0000},
+    {0xFA6D, 0x8218, 0x0000}, {0xFA70, 0x4E26, 0x0000}, {0xFA71, 0x51B5, 0x0000}, {0xFA72, 0x5168, 0x0000},
+    {0xFA73, 0x4F80, 0x0000}, {0xFA74, 0x5145, 0x0000}, {0xFA75, 0x5180, 0x0000}, {0xFA76, 0x52C7, 0x0000},
+    {0xFA77, 0x52FA, 0x0000}, {0xFA78, 0x559D, 0x0000}, {0xFA79, 0x5555, 0x0000}, {0xFA7A, 0x5599, 0x0000},
+    {0xFA7B, 0x55E2, 0x0000}, {0xFA7C, 0x585A, 0x0000}, {0xFA7D, 0x58B3, 0x0000}, {0xFA7E, 0x5944, 0x0000},
+    {0xFA7F, 0x5954, 0x0000}, {0xFA80, 0x5A62, 0x0000}, {0xFA81, 0x5B28, 0x0000}, {0xFA82, 0x5ED2, 0x0000},
+    {0xFA83, 0x5ED9, 0x0000}, {0xFA84, 0x5F69, 0x0000}, {0xFA85, 0x5FAD, 0x0000}, {0xFA86, 0x60D8, 0x0000},
+    {0xFA87, 0x614E, 0x0000}, {0xFA88, 0x6108, 0x0000}, {0xFA89, 0x618E, 0x0000}, {0xFA8A, 0x6160, 0x0000},
+    {0xFA8B, 0x61F2, 0x0000}, {0xFA8C, 0x6234, 0x0000}, {0xFA8D, 0x63C4, 0x0000}, {0xFA8E, 0x641C, 0x0000},
+    {0xFA8F, 0x6452, 0x0000}, {0xFA90, 0x6556, 0x0000}, {0xFA91, 0x6674, 0x0000}, {0xFA92, 0x6717, 0x0000},
+    {0xFA93, 0x671B, 0x0000}, {0xFA94, 0x6756, 0x0000}, {0xFA95, 0x6B79, 0x0000}, {0xFA96, 0x6BBA, 0x0000},
+    {0xFA97, 0x6D41, 0x0000}, {0xFA98, 0x6EDB, 0x0000}, {0xFA99, 0x6ECB, 0x0000}, {0xFA9A, 0x6F22, 0x0000},
+    {0xFA9B, 0x701E, 0x0000}, {0xFA9C, 0x716E, 0x0000}, {0xFA9D, 0x77A7, 0x0000}, {0xFA9E, 0x7235, 0x0000},
+    {0xFA9F, 0x72AF, 0x0000}, {0xFAA0, 0x732A, 0x0000}, {0xFAA1, 0x7471, 0x0000}, {0xFAA2, 0x7506, 0x0000},
+    {0xFAA3, 0x753B, 0x0000}, {0xFAA4, 0x761D, 0x0000}, {0xFAA5, 0x761F, 0x0000}, {0xFAA6, 0x76CA, 0x0000},
+    {0xFAA7, 0x76DB, 0x0000}, {0xFAA8, 0x76F4, 0x0000}, {0xFAA9, 0x774A, 0x0000}, {0xFAAA, 0x7740, 0x0000},
+    {0xFAAB, 0x78CC, 0x0000}, {0xFAAC, 0x7AB1, 0x0000}, {0xFAAD, 0x7BC0, 0x0000}, {0xFAAE, 0x7C7B, 0x0000},
+    {0xFAAF, 0x7D5B, 0x0000}, {0xFAB0, 0x7DF4, 0x0000}, {0xFAB1, 0x7F3E, 0x0000}, {0xFAB2, 0x8005, 0x0000},
+    {0xFAB3, 0x8352, 0x0000}, {0xFAB4, 0x83EF, 0x0000}, {0xFAB5, 0x8779, 0x0000}, {0xFAB6, 0x8941, 0x0000},
+    {0xFAB7, 0x8986, 0x0000}, {0xFAB8, 0x8996, 0x0000}, {0xFAB9, 0x8ABF, 0x0000}, {0xFABA, 0x8AF8, 0x0000},
+    {0xFABB, 0x8ACB, 0x0000}, {0xFABC, 0x8B01, 0x0000}, {0xFABD, 0x8AFE, 0x0000}, {0xFABE, 0x8AED, 0x0000},
+    {0xFABF, 0x8B39, 0x0000}, {0xFAC0, 0x8B8A, 0x0000}, {0xFAC1, 0x8D08, 0x0000}, {0xFAC2, 0x8F38, 0x0000},
+    {0xFAC3, 0x9072, 0x0000}, {0xFAC4, 0x9199, 0x0000}, {0xFAC5, 0x9276, 0x0000}, {0xFAC6, 0x967C, 0x0000},
+    {0xFAC7, 0x96E3, 0x0000}, {0xFAC8, 0x9756, 0x0000}, {0xFAC9, 0x97DB, 0x0000}, {0xFACA, 0x97FF, 0x0000},
+    {0xFACB, 0x980B, 0x0000}, {0xFACC, 0x983B, 0x0000}, {0xFACD, 0x9B12, 0x0000}, {0xFACE, 0x9F9C, 0x0000},
+    {0xFACF, 0x2284A, 0x0000}, {0xFAD0, 0x22844, 0x0000}, {0xFAD1, 0x233D5, 0x0000}, {0xFAD2, 0x3B9D, 0x0000},
+    {0xFAD3, 0x4018, 0x0000}, {0xFAD4, 0x4039, 0x0000}, {0xFAD5, 0x25249, 0x0000}, {0xFAD6, 0x25CD0, 0x0000},
+    {0xFAD7, 0x27ED3, 0x0000}, {0xFAD8, 0x9F43, 0x0000}, {0xFAD9, 0x9F8E, 0x0000}, {0xFB1D, 0x05D9, 0x05B4},
+    {0xFB1F, 0x05F2, 0x05B7}, {0xFB2A, 0x05E9, 0x05C1}, {0xFB2B, 0x05E9, 0x05C2}, {0xFB2C, 0xFB49, 0x05C1},
+    {0xFB2D, 0xFB49, 0x05C2}, {0xFB2E, 0x05D0, 0x05B7}, {0xFB2F, 0x05D0, 0x05B8}, {0xFB30, 0x05D0, 0x05BC},
+    {0xFB31, 0x05D1, 0x05BC}, {0xFB32, 0x05D2, 0x05BC}, {0xFB33, 0x05D3, 0x05BC}, {0xFB34, 0x05D4, 0x05BC},
+    {0xFB35, 0x05D5, 0x05BC}, {0xFB36, 0x05D6, 0x05BC}, {0xFB38, 0x05D8, 0x05BC}, {0xFB39, 0x05D9, 0x05BC},
+    {0xFB3A, 0x05DA, 0x05BC}, {0xFB3B, 0x05DB, 0x05BC}, {0xFB3C, 0x05DC, 0x05BC}, {0xFB3E, 0x05DE, 0x05BC},
+    {0xFB40, 0x05E0, 0x05BC}, {0xFB41, 0x05E1, 0x05BC}, {0xFB43, 0x05E3, 0x05BC}, {0xFB44, 0x05E4, 0x05BC},
+    {0xFB46, 0x05E6, 0x05BC}, {0xFB47, 0x05E7, 0x05BC}, {0xFB48, 0x05E8, 0x05BC}, {0xFB49, 0x05E9, 0x05BC},
+    {0xFB4A, 0x05EA, 0x05BC}, {0xFB4B, 0x05D5, 0x05B9}, {0xFB4C, 0x05D1, 0x05BF}, {0xFB4D, 0x05DB, 0x05BF},
+    {0xFB4E, 0x05E4, 0x05BF}, {0x1109A, 0x11099, 0x110BA}, {0x1109C, 0x1109B, 0x110BA}, {0x110AB, 0x110A5, 0x110BA},
+    {0x1112E, 0x11131, 0x11127}, {0x1112F, 0x11132, 0x11127}, {0x1134B, 0x11347, 0x1133E}, {0x1134C, 0x11347, 0x11357},
+    {0x114BB, 0x114B9, 0x114BA}, {0x114BC, 0x114B9, 0x114B0}, {0x114BE, 0x114B9, 0x114BD}, {0x115BA, 0x115B8, 0x115AF},
+    {0x115BB, 0x115B9, 0x115AF}, {0x11938, 0x11935, 0x11930}, {0x1D15E, 0x1D157, 0x1D165}, {0x1D15F, 0x1D158, 0x1D165},
+    {0x1D160, 0x1D15F, 0x1D16E}, {0x1D161, 0x1D15F, 0x1D16F}, {0x1D162, 0x1D15F, 0x1D170}, {0x1D163, 0x1D15F, 0x1D171},
+    {0x1D164, 0x1D15F, 0x1D172}, {0x1D1BB, 0x1D1B9, 0x1D165}, {0x1D1BC, 0x1D1BA, 0x1D165}, {0x1D1BD, 0x1D1BB, 0x1D16E},
+    {0x1D1BE, 0x1D1BC, 0x1D16E}, {0x1D1BF, 0x1D1BB, 0x1D16F}, {0x1D1C0, 0x1D1BC, 0x1D16F}, {0x2F800, 0x4E3D, 0x0000},
+    {0x2F801, 0x4E38, 0x0000}, {0x2F802, 0x4E41, 0x0000}, {0x2F803, 0x20122, 0x0000}, {0x2F804, 0x4F60, 0x0000},
+    {0x2F805, 0x4FAE, 0x0000}, {0x2F806, 0x4FBB, 0x0000}, {0x2F807, 0x5002, 0x0000}, {0x2F808, 0x507A, 0x0000},
+    {0x2F809, 0x5099, 0x0000}, {0x2F80A, 0x50E7, 0x0000}, {0x2F80B, 0x50CF, 0x0000}, {0x2F80C, 0x349E, 0x0000},
+    {0x2F80D, 0x2063A, 0x0000}, {0x2F80E, 0x514D, 0x0000}, {0x2F80F, 0x5154, 0x0000}, {0x2F810, 0x5164, 0x0000},
+    {0x2F811, 0x5177, 0x0000}, {0x2F812, 0x2051C, 0x0000}, {0x2F813, 0x34B9, 0x0000}, {0x2F814, 0x5167, 0x0000},
+    {0x2F815, 0x518D, 0x0000}, {0x2F816, 0x2054B, 0x0000}, {0x2F817, 0x5197, 0x0000}, {0x2F818, 0x51A4, 0x0000},
+    {0x2F819, 0x4ECC, 0x0000}, {0x2F81A, 0x51AC, 0x0000}, {0x2F81B, 0x51B5, 0x0000}, {0x2F81C, 0x291DF, 0x0000},
+    {0x2F81D, 0x51F5, 0x0000}, {0x2F81E, 0x5203, 0x0000}, {0x2F81F, 0x34DF, 0x0000}, {0x2F820, 0x523B, 0x0000},
+    {0x2F821, 0x5246, 0x0000}, {0x2F822, 0x5272, 0x0000}, {0x2F823, 0x5277, 0x0000}, {0x2F824, 0x3515, 0x0000},
+    {0x2F825, 0x52C7, 0x0000}, {0x2F826, 0x52C9, 0x0000}, {0x2F827, 0x52E4, 0x0000}, {0x2F828, 0x52FA, 0x0000},
+    {0x2F829, 0x5305, 0x0000}, {0x2F82A, 0x5306, 0x0000}, {0x2F82B, 0x5317, 0x0000}, {0x2F82C, 0x5349, 0x0000},
+    {0x2F82D, 0x5351, 0x0000}, {0x2F82E, 0x535A, 0x0000}, {0x2F82F, 0x5373, 0x0000}, {0x2F830, 0x537D, 0x0000},
+    {0x2F831, 0x537F, 0x0000}, {0x2F832, 0x537F, 0x0000}, {0x2F833, 0x537F, 0x0000}, {0x2F834, 0x20A2C, 0x0000},
+    {0x2F835, 0x7070, 0x0000}, {0x2F836, 0x53CA, 0x0000}, {0x2F837, 0x53DF, 0x0000}, {0x2F838, 0x20B63, 0x0000},
+    {0x2F839, 0x53EB, 0x0000}, {0x2F83A, 0x53F1, 0x0000}, {0x2F83B, 0x5406, 0x0000}, {0x2F83C, 0x549E, 0x0000},
+    {0x2F83D, 0x5438, 0x0000}, {0x2F83E, 0x5448, 0x0000}, {0x2F83F, 0x5468, 0x0000}, {0x2F840, 0x54A2, 0x0000},
+    {0x2F841, 0x54F6, 0x0000}, {0x2F842, 0x5510, 0x0000}, {0x2F843, 0x5553, 0x0000}, {0x2F844, 0x5563, 0x0000},
+    {0x2F845, 0x5584, 0x0000}, {0x2F846, 0x5584, 0x0000}, {0x2F847, 0x5599, 0x0000}, {0x2F848, 0x55AB, 0x0000},
+    {0x2F849, 0x55B3, 0x0000}, {0x2F84A, 0x55C2, 0x0000}, {0x2F84B, 0x5716, 0x0000}, {0x2F84C, 0x5606, 0x0000},
+    {0x2F84D, 0x5717, 0x0000}, {0x2F84E, 0x5651, 0x0000}, {0x2F84F, 0x5674, 0x0000}, {0x2F850, 0x5207, 0x0000},
+    {0x2F851, 0x58EE, 0x0000}, {0x2F852, 0x57CE, 0x0000}, {0x2F853, 0x57F4, 0x0000}, {0x2F854, 0x580D, 0x0000},
+    {0x2F855, 0x578B, 0x0000}, {0x2F856, 0x5832, 0x0000}, {0x2F857, 0x5831, 0x0000}, {0x2F858, 0x58AC, 0x0000},
+    {0x2F859, 0x214E4, 0x0000}, {0x2F85A, 0x58F2, 0x0000}, {0x2F85B, 0x58F7, 0x0000}, {0x2F85C, 0x5906, 0x0000},
+    {0x2F85D, 0x591A, 0x0000}, {0x2F85E, 0x5922, 0x0000}, {0x2F85F, 0x5962, 0x0000}, {0x2F860, 0x216A8, 0x0000},
+    {0x2F861, 0x216EA, 0x0000}, {0x2F862, 0x59EC, 0x0000}, {0x2F863, 0x5A1B, 0x0000}, {0x2F864, 0x5A27, 0x0000},
+    {0x2F865, 0x59D8, 0x0000}, {0x2F866, 0x5A66, 0x0000}, {0x2F867, 0x36EE, 0x0000}, {0x2F868, 0x36FC, 0x0000},
+    {0x2F869, 0x5B08, 0x0000}, {0x2F86A, 0x5B3E, 0x0000}, {0x2F86B, 0x5B3E, 0x0000}, {0x2F86C, 0x219C8, 0x0000},
+    {0x2F86D, 0x5BC3, 0x0000}, {0x2F86E, 0x5BD8, 0x0000}, {0x2F86F, 0x5BE7, 0x0000}, {0x2F870, 0x5BF3, 0x0000},
+    {0x2F871, 0x21B18, 0x0000}, {0x2F872, 0x5BFF, 0x0000}, {0x2F873, 0x5C06, 0x0000}, {0x2F874, 0x5F53, 0x0000},
+    {0x2F875, 0x5C22, 0x0000}, {0x2F876, 0x3781, 0x0000}, {0x2F877, 0x5C60, 0x0000}, {0x2F878, 0x5C6E, 0x0000},
+    {0x2F879, 0x5CC0, 0x0000}, {0x2F87A, 0x5C8D, 0x0000}, {0x2F87B, 0x21DE4, 0x0000}, {0x2F87C, 0x5D43, 0x0000},
+    {0x2F87D, 0x21DE6, 0x0000}, {0x2F87E, 0x5D6E, 0x0000}, {0x2F87F, 0x5D6B, 0x0000}, {0x2F880, 0x5D7C, 0x0000},
+    {0x2F881, 0x5DE1, 0x0000}, {0x2F882, 0x5DE2, 0x0000}, {0x2F883, 0x382F, 0x0000}, {0x2F884, 0x5DFD, 0x0000},
+    {0x2F885, 0x5E28, 0x0000}, {0x2F886, 0x5E3D, 0x0000}, {0x2F887, 0x5E69, 0x0000}, {0x2F888, 0x3862, 0x0000},
+    {0x2F889, 0x22183, 0x0000}, {0x2F88A, 0x387C, 0x0000}, {0x2F88B, 0x5EB0, 0x0000}, {0x2F88C, 0x5EB3, 0x0000},
+    {0x2F88D, 0x5EB6, 0x0000}, {0x2F88E, 0x5ECA, 0x0000}, {0x2F88F, 0x2A392, 0x0000}, {0x2F890, 0x5EFE, 0x0000},
+    {0x2F891, 0x22331, 0x0000}, {0x2F892, 0x22331, 0x0000}, {0x2F893, 0x8201, 0x0000}, {0x2F894, 0x5F22, 0x0000},
+    {0x2F895, 0x5F22, 0x0000}, {0x2F896, 0x38C7, 0x0000}, {0x2F897, 0x232B8, 0x0000}, {0x2F898, 0x261DA, 0x0000},
+    {0x2F899, 0x5F62, 0x0000}, {0x2F89A, 0x5F6B, 0x0000}, {0x2F89B, 0x38E3, 0x0000}, {0x2F89C, 0x5F9A, 0x0000},
+    {0x2F89D, 0x5FCD, 0x0000}, {0x2F89E, 0x5FD7, 0x0000}, {0x2F89F, 0x5FF9, 0x0000}, {0x2F8A0, 0x6081, 0x0000},
+    {0x2F8A1, 0x393A, 0x0000}, {0x2F8A2, 0x391C, 0x0000}, {0x2F8A3, 0x6094, 0x0000}, {0x2F8A4, 0x226D4, 0x0000},
+    {0x2F8A5, 0x60C7, 0x0000}, {0x2F8A6, 0x6148, 0x0000}, {0x2F8A7, 0x614C, 0x0000}, {0x2F8A8, 0x614E, 0x0000},
+    {0x2F8A9, 0x614C, 0x0000}, {0x2F8AA, 0x617A, 0x0000}, {0x2F8AB, 0x618E, 0x0000}, {0x2F8AC, 0x61B2, 0x0000},
+    {0x2F8AD, 0x61A4, 0x0000}, {0x2F8AE, 0x61AF, 0x0000}, {0x2F8AF, 0x61DE, 0x0000}, {0x2F8B0, 0x61F2, 0x0000},
+    {0x2F8B1, 0x61F6, 0x0000}, {0x2F8B2, 0x6210, 0x0000}, {0x2F8B3, 0x621B, 0x0000}, {0x2F8B4, 0x625D, 0x0000},
+    {0x2F8B5, 0x62B1, 0x0000}, {0x2F8B6, 0x62D4, 0x0000}, {0x2F8B7, 0x6350, 0x0000}, {0x2F8B8, 0x22B0C, 0x0000},
+    {0x2F8B9, 0x633D, 0x0000}, {0x2F8BA, 0x62FC, 0x0000}, {0x2F8BB, 0x6368, 0x0000}, {0x2F8BC, 0x6383, 0x0000},
+    {0x2F8BD, 0x63E4, 0x0000}, {0x2F8BE, 0x22BF1, 0x0000}, {0x2F8BF, 0x6422, 0x0000}, {0x2F8C0, 0x63C5, 0x0000},
+    {0x2F8C1, 0x63A9, 0x0000}, {0x2F8C2, 0x3A2E, 0x0000}, {0x2F8C3, 0x6469, 0x0000}, {0x2F8C4, 0x647E, 0x0000},
+    {0x2F8C5, 0x649D, 0x0000}, {0x2F8C6, 0x6477, 0x0000}, {0x2F8C7, 0x3A6C, 0x0000}, {0x2F8C8, 0x654F, 0x0000},
+    {0x2F8C9, 0x656C, 0x0000}, {0x2F8CA, 0x2300A, 0x0000}, {0x2F8CB, 0x65E3, 0x0000}, {0x2F8CC, 0x66F8, 0x0000},
+    {0x2F8CD, 0x6649, 0x0000}, {0x2F8CE, 0x3B19, 0x0000}, {0x2F8CF, 0x6691, 0x0000}, {0x2F8D0, 0x3B08, 0x0000},
+    {0x2F8D1, 0x3AE4, 0x0000}, {0x2F8D2, 0x5192, 0x0000}, {0x2F8D3, 0x5195, 0x0000}, {0x2F8D4, 0x6700, 0x0000},
+    {0x2F8D5, 0x669C, 0x0000}, {0x2F8D6, 0x80AD, 0x0000}, {0x2F8D7, 0x43D9, 0x0000}, {0x2F8D8, 0x6717, 0x0000},
+    {0x2F8D9, 0x671B, 0x0000}, {0x2F8DA, 0x6721, 0x0000}, {0x2F8DB, 0x675E, 0x0000}, {0x2F8DC, 0x6753, 0x0000},
+    {0x2F8DD, 0x233C3, 0x0000}, {0x2F8DE, 0x3B49, 0x0000}, {0x2F8DF, 0x67FA, 0x0000}, {0x2F8E0, 0x6785, 0x0000},
+    {0x2F8E1, 0x6852, 0x0000}, {0x2F8E2, 0x6885, 0x0000}, {0x2F8E3, 0x2346D, 0x0000}, {0x2F8E4, 0x688E, 0x0000},
+    {0x2F8E5, 0x681F, 0x0000}, {0x2F8E6, 0x6914, 0x0000}, {0x2F8E7, 0x3B9D, 0x0000}, {0x2F8E8, 0x6942, 0x0000},
+    {0x2F8E9, 0x69A3, 0x0000}, {0x2F8EA, 0x69EA, 0x0000}, {0x2F8EB, 0x6AA8, 0x0000}, {0x2F8EC, 0x236A3, 0x0000},
+    {0x2F8ED, 0x6ADB, 0x0000}, {0x2F8EE, 0x3C18, 0x0000}, {0x2F8EF, 0x6B21, 0x0000}, {0x2F8F0, 0x238A7, 0x0000},
+    {0x2F8F1, 0x6B54, 0x0000}, {0x2F8F2, 0x3C4E, 0x0000}, {0x2F8F3, 0x6B72, 0x0000}, {0x2F8F4, 0x6B9F, 0x0000},
+    {0x2F8F5, 0x6BBA, 0x0000}, {0x2F8F6, 0x6BBB, 0x0000}, {0x2F8F7, 0x23A8D, 0x0000}, {0x2F8F8, 0x21D0B, 0x0000},
+    {0x2F8F9, 0x23AFA, 0x0000}, {0x2F8FA, 0x6C4E, 0x0000}, {0x2F8FB, 0x23CBC, 0x0000}, {0x2F8FC, 0x6CBF, 0x0000},
+    {0x2F8FD, 0x6CCD, 0x0000}, {0x2F8FE, 0x6C67, 0x0000}, {0x2F8FF, 0x6D16, 0x0000}, {0x2F900, 0x6D3E, 0x0000},
+    {0x2F901, 0x6D77, 0x0000}, {0x2F902, 0x6D41, 0x0000}, {0x2F903, 0x6D69, 0x0000}, {0x2F904, 0x6D78, 0x0000},
+    {0x2F905, 0x6D85, 0x0000}, {0x2F906, 0x23D1E, 0x0000}, {0x2F907, 0x6D34, 0x0000}, {0x2F908, 0x6E2F, 0x0000},
+    {0x2F909, 0x6E6E, 0x0000}, {0x2F90A, 0x3D33, 0x0000}, {0x2F90B, 0x6ECB, 0x0000}, {0x2F90C, 0x6EC7, 0x0000},
+    {0x2F90D, 0x23ED1, 0x0000}, {0x2F90E, 0x6DF9, 0x0000}, {0x2F90F, 0x6F6E, 0x0000}, {0x2F910, 0x23F5E, 0x0000},
+    {0x2F911, 0x23F8E, 0x0000}, {0x2F912, 0x6FC6, 0x0000}, {0x2F913, 0x7039, 0x0000}, {0x2F914, 0x701E, 0x0000},
+    {0x2F915, 0x701B, 0x0000}, {0x2F916, 0x3D96, 0x0000}, {0x2F917, 0x704A, 0x0000}, {0x2F918, 0x707D, 0x0000},
+    {0x2F919, 0x7077, 0x0000}, {0x2F91A, 0x70AD, 0x0000}, {0x2F91B, 0x20525, 0x0000}, {0x2F91C, 0x7145, 0x0000},
+    {0x2F91D, 0x24263, 0x0000}, {0x2F91E, 0x719C, 0x0000}, {0x2F91F, 0x243AB, 0x0000}, {0x2F920, 0x7228, 0x0000},
+    {0x2F921, 0x7235, 0x0000}, {0x2F922, 0x7250, 0x0000}, {0x2F923, 0x24608, 0x0000}, {0x2F924, 0x7280, 0x0000},
+    {0x2F925, 0x7295, 0x0000}, {0x2F926, 0x24735, 0x0000}, {0x2F927, 0x24814, 0x0000}, {0x2F928, 0x737A, 0x0000},
+    {0x2F929, 0x738B, 0x0000}, {0x2F92A, 0x3EAC, 0x0000}, {0x2F92B, 0x73A5, 0x0000}, {0x2F92C, 0x3EB8, 0x0000},
+    {0x2F92D, 0x3EB8, 0x0000}, {0x2F92E, 0x7447, 0x0000}, {0x2F92F, 0x745C, 0x0000}, {0x2F930, 0x7471, 0x0000},
+    {0x2F931, 0x7485, 0x0000}, {0x2F932, 0x74CA, 0x0000}, {0x2F933, 0x3F1B, 0x0000}, {0x2F934, 0x7524, 0x0000},
+    {0x2F935, 0x24C36, 0x0000}, {0x2F936, 0x753E, 0x0000}, {0x2F937, 0x24C92, 0x0000}, {0x2F938, 0x7570, 0x0000},
+    {0x2F939, 0x2219F, 0x0000}, {0x2F93A, 0x7610, 0x0000}, {0x2F93B, 0x24FA1, 0x0000}, {0x2F93C, 0x24FB8, 0x0000},
+    {0x2F93D, 0x25044, 0x0000}, {0x2F93E, 0x3FFC, 0x0000}, {0x2F93F, 0x4008, 0x0000}, {0x2F940, 0x76F4, 0x0000},
+    {0x2F941, 0x250F3, 0x0000}, {0x2F942, 0x250F2, 0x0000}, {0x2F943, 0x25119, 0x0000}, {0x2F944, 0x25133, 0x0000},
+    {0x2F945, 0x771E, 0x0000}, {0x2F946, 0x771F, 0x0000}, {0x2F947, 0x771F, 0x0000}, {0x2F948, 0x774A, 0x0000},
+    {0x2F949, 0x4039, 0x0000}, {0x2F94A, 0x778B, 0x0000}, {0x2F94B, 0x4046, 0x0000}, {0x2F94C, 0x4096, 0x0000},
+    {0x2F94D, 0x2541D, 0x0000}, {0x2F94E, 0x784E, 0x0000}, {0x2F94F, 0x788C, 0x0000}, {0x2F950, 0x78CC, 0x0000},
+    {0x2F951, 0x40E3, 0x0000}, {0x2F952, 0x25626, 0x0000}, {0x2F953, 0x7956, 0x0000}, {0x2F954, 0x2569A, 0x0000},
+    {0x2F955, 0x256C5, 0x0000}, {0x2F956, 0x798F, 0x0000}, {0x2F957, 0x79EB, 0x0000}, {0x2F958, 0x412F, 0x0000},
+    {0x2F959, 0x7A40, 0x0000}, {0x2F95A, 0x7A4A, 0x0000}, {0x2F95B, 0x7A4F, 0x0000}, {0x2F95C, 0x2597C, 0x0000},
+    {0x2F95D, 0x25AA7, 0x0000}, {0x2F95E, 0x25AA7, 0x0000}, {0x2F95F, 0x7AEE, 0x0000}, {0x2F960, 0x4202, 0x0000},
+    {0x2F961, 0x25BAB, 0x0000}, {0x2F962, 0x7BC6, 0x0000}, {0x2F963, 0x7BC9, 0x0000}, {0x2F964, 0x4227, 0x0000},
+    {0x2F965, 0x25C80, 0x0000}, {0x2F966, 0x7CD2, 0x0000}, {0x2F967, 0x42A0, 0x0000}, {0x2F968, 0x7CE8, 0x0000},
+    {0x2F969, 0x7CE3, 0x0000}, {0x2F96A, 0x7D00, 0x0000}, {0x2F96B, 0x25F86, 0x0000}, {0x2F96C, 0x7D63, 0x0000},
+    {0x2F96D, 0x4301, 0x0000}, {0x2F96E, 0x7DC7, 0x0000}, {0x2F96F, 0x7E02, 0x0000}, {0x2F970, 0x7E45, 0x0000},
+    {0x2F971, 0x4334, 0x0000}, {0x2F972, 0x26228, 0x0000}, {0x2F973, 0x26247, 0x0000}, {0x2F974, 0x4359, 0x0000},
+    {0x2F975, 0x262D9, 0x0000}, {0x2F976, 0x7F7A, 0x0000}, {0x2F977, 0x2633E, 0x0000}, {0x2F978, 0x7F95, 0x0000},
+    {0x2F979, 0x7FFA, 0x0000}, {0x2F97A, 0x8005, 0x0000}, {0x2F97B, 0x264DA, 0x0000}, {0x2F97C, 0x26523, 0x0000},
+    {0x2F97D, 0x8060, 0x0000}, {0x2F97E, 0x265A8, 0x0000}, {0x2F97F, 0x8070, 0x0000}, {0x2F980, 0x2335F, 0x0000},
+    {0x2F981, 0x43D5, 0x0000}, {0x2F982, 0x80B2, 0x0000}, {0x2F983, 0x8103, 0x0000}, {0x2F984, 0x440B, 0x0000},
+    {0x2F985, 0x813E, 0x0000}, {0x2F986, 0x5AB5, 0x0000}, {0x2F987, 0x267A7, 0x0000}, {0x2F988, 0x267B5, 0x0000},
+    {0x2F989, 0x23393, 0x0000}, {0x2F98A, 0x2339C, 0x0000}, {0x2F98B, 0x8201, 0x0000}, {0x2F98C, 0x8204, 0x0000},
+    {0x2F98D, 0x8F9E, 0x0000}, {0x2F98E, 0x446B, 0x0000}, {0x2F98F, 0x8291, 0x0000}, {0x2F990, 0x828B, 0x0000},
+    {0x2F991, 0x829D, 0x0000}, {0x2F992, 0x52B3, 0x0000}, {0x2F993, 0x82B1, 0x0000}, {0x2F994, 0x82B3, 0x0000},
+    {0x2F995, 0x82BD, 0x0000}, {0x2F996, 0x82E6, 0x0000}, {0x2F997, 0x26B3C, 0x0000}, {0x2F998, 0x82E5, 0x0000},
+    {0x2F999, 0x831D, 0x0000}, {0x2F99A, 0x8363, 0x0000}, {0x2F99B, 0x83AD, 0x0000}, {0x2F99C, 0x8323, 0x0000},
+    {0x2F99D, 0x83BD, 0x0000}, {0x2F99E, 0x83E7, 0x0000}, {0x2F99F, 0x8457, 0x0000}, {0x2F9A0, 0x8353, 0x0000},
+    {0x2F9A1, 0x83CA, 0x0000}, {0x2F9A2, 0x83CC, 0x0000}, {0x2F9A3, 0x83DC, 0x0000}, {0x2F9A4, 0x26C36, 0x0000},
+    {0x2F9A5, 0x26D6B, 0x0000}, {0x2F9A6, 0x26CD5, 0x0000}, {0x2F9A7, 0x452B, 0x0000}, {0x2F9A8, 0x84F1, 0x0000},
+    {0x2F9A9, 0x84F3, 0x0000}, {0x2F9AA, 0x8516, 0x0000}, {0x2F9AB, 0x273CA, 0x0000}, {0x2F9AC, 0x8564, 0x0000},
+    {0x2F9AD, 0x26F2C, 0x0000}, {0x2F9AE, 0x455D, 0x0000}, {0x2F9AF, 0x4561, 0x0000}, {0x2F9B0, 0x26FB1, 0x0000},
+    {0x2F9B1, 0x270D2, 0x0000}, {0x2F9B2, 0x456B, 0x0000}, {0x2F9B3, 0x8650, 0x0000}, {0x2F9B4, 0x865C, 0x0000},
+    {0x2F9B5, 0x8667, 0x0000}, {0x2F9B6, 0x8669, 0x0000}, {0x2F9B7, 0x86A9, 0x0000}, {0x2F9B8, 0x8688, 0x0000},
+    {0x2F9B9, 0x870E, 0x0000}, {0x2F9BA, 0x86E2, 0x0000}, {0x2F9BB, 0x8779, 0x0000}, {0x2F9BC, 0x8728, 0x0000},
+    {0x2F9BD, 0x876B, 0x0000}, {0x2F9BE, 0x8786, 0x0000}, {0x2F9BF, 0x45D7, 0x0000}, {0x2F9C0, 0x87E1, 0x0000},
+    {0x2F9C1, 0x8801, 0x0000}, {0x2F9C2, 0x45F9, 0x0000}, {0x2F9C3, 0x8860, 0x0000}, {0x2F9C4, 0x8863, 0x0000},
+    {0x2F9C5, 0x27667, 0x0000}, {0x2F9C6, 0x88D7, 0x0000}, {0x2F9C7, 0x88DE, 0x0000}, {0x2F9C8, 0x4635, 0x0000},
+    {0x2F9C9, 0x88FA, 0x0000}, {0x2F9CA, 0x34BB, 0x0000}, {0x2F9CB, 0x278AE, 0x0000}, {0x2F9CC, 0x27966, 0x0000},
+    {0x2F9CD, 0x46BE, 0x0000}, {0x2F9CE, 0x46C7, 0x0000}, {0x2F9CF, 0x8AA0, 0x0000}, {0x2F9D0, 0x8AED, 0x0000},
+    {0x2F9D1, 0x8B8A, 0x0000}, {0x2F9D2, 0x8C55, 0x0000}, {0x2F9D3, 0x27CA8, 0x0000}, {0x2F9D4, 0x8CAB, 0x0000},
+    {0x2F9D5, 0x8CC1, 0x0000}, {0x2F9D6, 0x8D1B, 0x0000}, {0x2F9D7, 0x8D77, 0x0000}, {0x2F9D8, 0x27F2F, 0x0000},
+    {0x2F9D9, 0x20804, 0x0000}, {0x2F9DA, 0x8DCB, 0x0000}, {0x2F9DB, 0x8DBC, 0x0000}, {0x2F9DC, 0x8DF0, 0x0000},
+    {0x2F9DD, 0x208DE, 0x0000}, {0x2F9DE, 0x8ED4, 0x0000}, {0x2F9DF, 0x8F38, 0x0000}, {0x2F9E0, 0x285D2, 0x0000},
+    {0x2F9E1, 0x285ED, 0x0000}, {0x2F9E2, 0x9094, 0x0000}, {0x2F9E3, 0x90F1, 0x0000}, {0x2F9E4, 0x9111, 0x0000},
+    {0x2F9E5, 0x2872E, 0x0000}, {0x2F9E6, 0x911B, 0x0000}, {0x2F9E7, 0x9238, 0x0000}, {0x2F9E8, 0x92D7, 0x0000},
+    {0x2F9E9, 0x92D8, 0x0000}, {0x2F9EA, 0x927C, 0x0000}, {0x2F9EB, 0x93F9, 0x0000}, {0x2F9EC, 0x9415, 0x0000},
+    {0x2F9ED, 0x28BFA, 0x0000}, {0x2F9EE, 0x958B, 0x0000}, {0x2F9EF, 0x4995, 0x0000}, {0x2F9F0, 0x95B7, 0x0000},
+    {0x2F9F1, 0x28D77, 0x0000}, {0x2F9F2, 0x49E6, 0x0000}, {0x2F9F3, 0x96C3, 0x0000}, {0x2F9F4, 0x5DB2, 0x0000},
+    {0x2F9F5, 0x9723, 0x0000}, {0x2F9F6, 0x29145, 0x0000}, {0x2F9F7, 0x2921A, 0x0000}, {0x2F9F8, 0x4A6E, 0x0000},
+    {0x2F9F9, 0x4A76, 0x0000}, {0x2F9FA, 0x97E0, 0x0000}, {0x2F9FB, 0x2940A, 0x0000}, {0x2F9FC, 0x4AB2, 0x0000},
+    {0x2F9FD, 0x29496, 0x0000}, {0x2F9FE, 0x980B, 0x0000}, {0x2F9FF, 0x980B, 0x0000}, {0x2FA00, 0x9829, 0x0000},
+    {0x2FA01, 0x295B6, 0x0000}, {0x2FA02, 0x98E2, 0x0000}, {0x2FA03, 0x4B33, 0x0000}, {0x2FA04, 0x9929, 0x0000},
+    {0x2FA05, 0x99A7, 0x0000}, {0x2FA06, 0x99C2, 0x0000}, {0x2FA07, 0x99FE, 0x0000}, {0x2FA08, 0x4BCE, 0x0000},
+    {0x2FA09, 0x29B30, 0x0000}, {0x2FA0A, 0x9B12, 0x0000}, {0x2FA0B, 0x9C40, 0x0000}, {0x2FA0C, 0x9CFD, 0x0000},
+    {0x2FA0D, 0x4CCE, 0x0000}, {0x2FA0E, 0x4CED, 0x0000}, {0x2FA0F, 0x9D67, 0x0000}, {0x2FA10, 0x2A0CE, 0x0000},
+    {0x2FA11, 0x4CF8, 0x0000}, {0x2FA12, 0x2A105, 0x0000}, {0x2FA13, 0x2A20E, 0x0000}, {0x2FA14, 0x2A291, 0x0000},
+    {0x2FA15, 0x9EBB, 0x0000}, {0x2FA16, 0x4D56, 0x0000}, {0x2FA17, 0x9EF9, 0x0000}, {0x2FA18, 0x9EFE, 0x0000},
+    {0x2FA19, 0x9F05, 0x0000}, {0x2FA1A, 0x9F0F, 0x0000}, {0x2FA1B, 0x9F16, 0x0000}, {0x2FA1C, 0x9F3B, 0x0000},
+    {0x2FA1D, 0x2A600, 0x0000},
+};
+static const char32_t kCompositionExclusions[] = {
+    0x0344, 0x0958, 0x0959, 0x095A, 0x095B, 0x095C, 0x095D, 0x095E, 0x095F, 0x09DC,
+    0x09DD, 0x09DF, 0x0A33, 0x0A36, 0x0A59, 0x0A5A, 0x0A5B, 0x0A5E, 0x0B5C, 0x0B5D,
+    0x0F43, 0x0F4D, 0x0F52, 0x0F57, 0x0F5C, 0x0F69, 0x0F73, 0x0F75, 0x0F76, 0x0F78,
+    0x0F81, 0x0F93, 0x0F9D, 0x0FA2, 0x0FA7, 0x0FAC, 0x0FB9, 0x2ADC, 0xFB1D, 0xFB1F,
+    0xFB2A, 0xFB2B, 0xFB2C, 0xFB2D, 0xFB2E, 0xFB2F, 0xFB30, 0xFB31, 0xFB32, 0xFB33,
+    0xFB34, 0xFB35, 0xFB36, 0xFB38, 0xFB39, 0xFB3A, 0xFB3B, 0xFB3C, 0xFB3E, 0xFB40,
+    0xFB41, 0xFB43, 0xFB44, 0xFB46, 0xFB47, 0xFB48, 0xFB49, 0xFB4A, 0xFB4B, 0xFB4C,
+    0xFB4D, 0xFB4E, 0x1D15E, 0x1D15F, 0x1D160, 0x1D161, 0x1D162, 0x1D163, 0x1D164, 0x1D1BB,
+    0x1D1BC, 0x1D1BD, 0x1D1BE, 0x1D1BF, 0x1D1C0,
+};
+static const CompatRange kCompatRanges[] = {
+    {0x00A0, 1, -128}, {0x00AA, 1, -73}, {0x00B2, 2, -128}, {0x00B5, 1, 775}, {0x00B9, 1, -136},
+    {0x00BA, 1, -75}, {0x017F, 1, -268}, {0x02B0, 1, -584}, {0x02B1, 1, -75}, {0x02B2, 1, -584},
+    {0x02B3, 1, -577}, {0x02B4, 1, -59}, {0x02B5, 1, -58}, {0x02B6, 1, -53}, {0x02B7, 1, -576},
+    {0x02B8, 1, -575}, {0x02E0, 1, -125}, {0x02E1, 1, -629}, {0x02E2, 1, -623}, {0x02E3, 1, -619},
+    {0x02E4, 1, -79}, {0x03D0, 1, -30}, {0x03D1, 1, -25}, {0x03D2, 1, -45}, {0x03D5, 1, -15},
+    {0x03D6, 1, -22}, {0x03F0, 1, -54}, {0x03F1, 2, -48}, {0x03F4, 1, -92}, {0x03F5, 1, -64},
+    {0x03F9, 1, -86}, {0x0F0C, 1, -1}, {0x10FC, 1, -32}, {0x1D2C, 1, -7403}, {0x1D2D, 1, -7271},
+    {0x1D2E, 1, -7404}, {0x1D30, 2, -7404}, {0x1D32, 1, -7076}, {0x1D33, 8, -7404}, {0x1D3C, 1, -7405},
+    {0x1D3D, 1, -6939}, {0x1D3E, 1, -7406}, {0x1D3F, 1, -7405}, {0x1D40, 2, -7404}, {0x1D42, 1, -7403},
+    {0x1D43, 1, -7394}, {0x1D44, 2, -6900}, {0x1D46, 1, -68}, {0x1D47, 1, -7397}, {0x1D48, 2, -7396},
+    {0x1D4A, 1, -6897}, {0x1D4B, 2, -6896}, {0x1D4D, 1, -7398}, {0x1D4F, 1, -7396}, {0x1D50, 1, -7395},
+    {0x1D51, 1, -7174}, {0x1D52, 1, -7395}, {0x1D53, 1, -6911}, {0x1D54, 2, -62}, {0x1D56, 1, -7398},
+    {0x1D57, 2, -7395}, {0x1D59, 1, -60}, {0x1D5A, 1, -6891}, {0x1D5B, 1, -7397}, {0x1D5C, 1, -55},
+    {0x1D5D, 3, -6571}, {0x1D60, 2, -6554}, {0x1D62, 1, -7417}, {0x1D63, 1, -7409}, {0x1D64, 2, -7407},
+    {0x1D66, 2, -6580}, {0x1D68, 1, -6567}, {0x1D69, 2, -6563}, {0x1D78, 1, -6459}, {0x1D9B, 1, -6985},
+    {0x1D9C, 1, -7481}, {0x1D9D, 1, -6984}, {0x1D9E, 1, -7342}, {0x1D9F, 1, -6979}, {0x1DA0, 1, -7482},
+    {0x1DA1, 1, -6978}, {0x1DA2, 1, -6977}, {0x1DA3, 1, -6974}, {0x1DA4, 3, -6972}, {0x1DA7, 1, -44},
+    {0x1DA8, 1, -6923}, {0x1DA9, 1, -6972}, {0x1DAA, 1, -37}, {0x1DAB, 1, -6924}, {0x1DAC, 1, -6971},
+    {0x1DAD, 1, -6973}, {0x1DAE, 4, -6972}, {0x1DB2, 1, -6970}, {0x1DB3, 2, -6961}, {0x1DB5, 1, -7178},
+    {0x1DB6, 2, -6957}, {0x1DB8, 1, -156}, {0x1DB9, 2, -6958}, {0x1DBB, 1, -7489}, {0x1DBC, 3, -6956},
+    {0x1DBF, 1, -6663}, {0x2002, 1, -8162}, {0x2003, 1, -8163}, {0x2004, 1, -8164}, {0x2005, 1, -8165},
+    {0x2006, 1, -8166}, {0x2007, 1, -8167}, {0x2008, 1, -8168}, {0x2009, 1, -8169}, {0x200A, 1, -8170},
+    {0x2011, 1, -1}, {0x2024, 1, -8182}, {0x202F, 1, -8207}, {0x205F, 1, -8255}, {0x2070, 1, -8256},
+    {0x2071, 1, -8200}, {0x2074, 6, -8256}, {0x207A, 1, -8271}, {0x207B, 1, 407}, {0x207C, 1, -8255},
+    {0x207D, 2, -8277}, {0x207F, 1, -8209}, {0x2080, 10, -8272}, {0x208A, 1, -8287}, {0x208B, 1, 391},
+    {0x208C, 1, -8271}, {0x208D, 2, -8293}, {0x2090, 1, -8239}, {0x2091, 1, -8236}, {0x2092, 1, -8227},
+    {0x2093, 1, -8219}, {0x2094, 1, -7739}, {0x2095, 1, -8237}, {0x2096, 4, -8235}, {0x209A, 1, -8234},
+    {0x209B, 2, -8232}, {0x2102, 1, -8383}, {0x2107, 1, -8055}, {0x210A, 1, -8355}, {0x210B, 1, -8387},
+    {0x210C, 1, -8388}, {0x210D, 1, -8389}, {0x210E, 1, -8358}, {0x210F, 1, -8168}, {0x2110, 1, -8391},
+    {0x2111, 1, -8392}, {0x2112, 1, -8390}, {0x2113, 1, -8359}, {0x2115, 1, -8391}, {0x2119, 3, -8393},
+    {0x211C, 1, -8394}, {0x211D, 1, -8395}, {0x2124, 1, -8394}, {0x2128, 1, -8398}, {0x212C, 2, -8426},
+    {0x212F, 1, -8394}, {0x2130, 2, -8427}, {0x2133, 1, -8422}, {0x2134, 1, -8389}, {0x2135, 4, -7013},
+    {0x2139, 1, -8400}, {0x213C, 1, -7548}, {0x213D, 1, -7562}, {0x213E, 1, -7595}, {0x213F, 1, -7583},
+    {0x2140, 1, 209}, {0x2145, 1, -8449}, {0x2146, 2, -8418}, {0x2148, 2, -8415}, {0x2160, 1, -8471},
+    {0x2164, 1, -8462}, {0x2169, 1, -8465}, {0x216C, 1, -8480}, {0x216D, 2, -8490}, {0x216F, 1, -8482},
+    {0x2170, 1, -8455}, {0x2174, 1, -8446}, {0x2179, 1, -8449}, {0x217C, 1, -8464}, {0x217D, 2, -8474},
+    {0x217F, 1, -8466}, {0x2460, 9, -9263}, {0x24B6, 26, -9333}, {0x24D0, 26, -9327}, {0x24EA, 1, -9402},
+    {0x2C7C, 1, -11282}, {0x2C7D, 1, -11303}, {0x2D6F, 1, -14}, {0x2E9F, 1, 15662}, {0x2EF3, 1, 28844},
+    {0x2F00, 1, 7936}, {0x2F01, 1, 7975}, {0x2F02, 1, 7988}, {0x2F03, 1, 7996}, {0x2F04, 1, 8021},
+    {0x2F05, 1, 8064}, {0x2F06, 1, 8070}, {0x2F07, 1, 8089}, {0x2F08, 1, 8114}, {0x2F09, 1, 8758},
+    {0x2F0A, 1, 8795}, {0x2F0B, 1, 8800}, {0x2F0C, 1, 8822}, {0x2F0D, 1, 8841}, {0x2F0E, 1, 8861},
+    {0x2F0F, 1, 8913}, {0x2F10, 1, 8933}, {0x2F11, 1, 8943}, {0x2F12, 1, 9097}, {0x2F13, 1, 9190},
+    {0x2F14, 1, 9217}, {0x2F15, 1, 9221}, {0x2F16, 1, 9250}, {0x2F17, 1, 9258}, {0x2F18, 1, 9284},
+    {0x2F19, 1, 9296}, {0x2F1A, 1, 9320}, {0x2F1B, 1, 9371}, {0x2F1C, 1, 9388}, {0x2F1D, 1, 9414},
+    {0x2F1E, 1, 10169}, {0x2F1F, 1, 10240}, {0x2F20, 1, 10699}, {0x2F21, 1, 10721}, {0x2F22, 1, 10728},
+    {0x2F23, 1, 10738}, {0x2F24, 1, 10755}, {0x2F25, 1, 10830}, {0x2F26, 1, 11306}, {0x2F27, 1, 11353},
+    {0x2F28, 1, 11472}, {0x2F29, 1, 11494}, {0x2F2A, 1, 11512}, {0x2F2B, 1, 11533}, {0x2F2C, 1, 11586},
+    {0x2F2D, 1, 11588}, {0x2F2E, 1, 11949}, {0x2F2F, 1, 11958}, {0x2F30, 1, 11969}, {0x2F31, 1, 11981},
+    {0x2F32, 1, 12096}, {0x2F33, 1, 12103}, {0x2F34, 1, 12107}, {0x2F35, 1, 12223}, {0x2F36, 1, 12232},
+    {0x2F37, 1, 12244}, {0x2F38, 1, 12251}, {0x2F39, 1, 12311}, {0x2F3A, 1, 12327}, {0x2F3B, 1, 12344},
+    {0x2F3C, 1, 12423}, {0x2F3D, 1, 13003}, {0x2F3E, 1, 13048}, {0x2F3F, 1, 13068}, {0x2F40, 1, 13807},
+    {0x2F41, 1, 13811}, {0x2F42, 1, 13893}, {0x2F43, 1, 13908}, {0x2F44, 1, 13920}, {0x2F45, 1, 13940},
+    {0x2F46, 1, 13978}, {0x2F47, 1, 13982}, {0x2F48, 1, 14248}, {0x2F49, 1, 14271}, {0x2F4A, 1, 14302},
+    {0x2F4B, 1, 15317}, {0x2F4C, 1, 15382}, {0x2F4D, 1, 15404}, {0x2F4E, 1, 15461}, {0x2F4F, 1, 15484},
+    {0x2F50, 1, 15492}, {0x2F51, 1, 15498}, {0x2F52, 1, 15549}, {0x2F53, 1, 15553}, {0x2F54, 1, 15584},
+    {0x2F55, 1, 16662}, {0x2F56, 1, 17108}, {0x2F57, 1, 17119}, {0x2F58, 1, 17123}, {0x2F59, 1, 17126},
+    {0x2F5A, 1, 17133}, {0x2F5B, 1, 17150}, {0x2F5C, 1, 17151}, {0x2F5D, 1, 17231}, {0x2F5E, 1, 17446},
+    {0x2F5F, 1, 17450}, {0x2F60, 1, 17788}, {0x2F61, 1, 17797}, {0x2F62, 1, 17846}, {0x2F63, 1, 17852},
+    {0x2F64, 1, 17860}, {0x2F65, 1, 17867}, {0x2F66, 1, 17957}, {0x2F67, 1, 17963}, {0x2F68, 1, 18190},
+    {0x2F69, 1, 18196}, {0x2F6A, 1, 18244}, {0x2F6B, 1, 18260}, {0x2F6C, 1, 18306}, {0x2F6D, 1, 18542},
+    {0x2F6E, 1, 18548}, {0x2F6F, 1, 18564}, {0x2F70, 1, 18890}, {0x2F71, 1, 19015}, {0x2F72, 1, 19020},
+    {0x2F73, 1, 19201}, {0x2F74, 1, 19287}, {0x2F75, 1, 19332}, {0x2F76, 1, 19709}, {0x2F77, 1, 19841},
+    {0x2F78, 1, 20414}, {0x2F79, 1, 20440}, {0x2F7A, 1, 20496}, {0x2F7B, 1, 20546}, {0x2F7C, 1, 20613},
+    {0x2F7D, 1, 20623}, {0x2F7E, 1, 20628}, {0x2F7F, 1, 20660}, {0x2F80, 1, 20735}, {0x2F81, 1, 20744},
+    {0x2F82, 1, 21089}, {0x2F83, 1, 21095}, {0x2F84, 1, 21103}, {0x2F85, 1, 21111}, {0x2F86, 1, 21126},
+    {0x2F87, 1, 21140}, {0x2F88, 1, 21143}, {0x2F89, 1, 21221}, {0x2F8A, 1, 21224}, {0x2F8B, 1, 21229},
+    {0x2F8C, 1, 22209}, {0x2F8D, 1, 22238}, {0x2F8E, 1, 22706}, {0x2F8F, 1, 22717}, {0x2F90, 1, 22739},
+    {0x2F91, 1, 23021}, {0x2F92, 1, 23033}, {0x2F93, 1, 23103}, {0x2F94, 1, 23148}, {0x2F95, 1, 23714},
+    {0x2F96, 1, 23728}, {0x2F97, 1, 23742}, {0x2F98, 1, 23776}, {0x2F99, 1, 23812}, {0x2F9A, 1, 24010},
+    {0x2F9B, 1, 24021}, {0x2F9C, 1, 24087}, {0x2F9D, 1, 24334}, {0x2F9E, 1, 24364}, {0x2F9F, 1, 24572},
+    {0x2FA0, 1, 24592}, {0x2FA1, 1, 24596}, {0x2FA2, 1, 24815}, {0x2FA3, 1, 24998}, {0x2FA4, 1, 25122},
+    {0x2FA5, 1, 25127}, {0x2FA6, 1, 25131}, {0x2FA7, 1, 26064}, {0x2FA8, 1, 26072}, {0x2FA9, 1, 26227},
+    {0x2FAA, 1, 26380}, {0x2FAB, 1, 26382}, {0x2FAC, 1, 26428}, {0x2FAD, 1, 26532}, {0x2FAE, 1, 26544},
+    {0x2FAF, 1, 26547}, {0x2FB0, 1, 26553}, {0x2FB1, 1, 26650}, {0x2FB2, 1, 26683}, {0x2FB3, 1, 26688},
+    {0x2FB4, 1, 26701}, {0x2FB5, 1, 26867}, {0x2FB6, 1, 26917}, {0x2FB7, 1, 26920}, {0x2FB8, 1, 27102},
+    {0x2FB9, 1, 27104}, {0x2FBA, 1, 27122}, {0x2FBB, 1, 27373}, {0x2FBC, 1, 27420}, {0x2FBD, 1, 27426},
+    {0x2FBE, 1, 27495}, {0x2FBF, 1, 27504}, {0x2FC0, 1, 27506}, {0x2FC1, 1, 27515}, {0x2FC2, 1, 27544},
+    {0x2FC3, 1, 27938}, {0x2FC4, 1, 28337}, {0x2FC5, 1, 28346}, {0x2FC6, 1, 28383}, {0x2FC7, 1, 28404},
+    {0x2FC8, 1, 28411}, {0x2FC9, 1, 28420}, {0x2FCA, 1, 28423}, {0x2FCB, 1, 28462}, {0x2FCC, 1, 28465},
+    {0x2FCD, 1, 28481}, {0x2FCE, 1, 28485}, {0x2FCF, 1, 28497}, {0x2FD0, 1, 28523}, {0x2FD1, 1, 28537},
+    {0x2FD2, 1, 28544}, {0x2FD3, 1, 28602}, {0x2FD4, 1, 28616}, {0x2FD5, 1, 28619}, {0x3000, 1, -12256},
+    {0x3036, 1, -36}, {0x3038, 1, 8969}, {0x3039, 2, 8971}, {0x3131, 2, -8241}, {0x3133, 1, -8073},
+    {0x3134, 1, -8242}, {0x3135, 2, -8073}, {0x3137, 3, -8244}, {0x313A, 6, -8074}, {0x3140, 1, -8230},
+    {0x3141, 3, -8251}, {0x3144, 1, -8227}, {0x3145, 10, -8252}, {0x314F, 21, -8174}, {0x3164, 1, -8196},
+    {0x3165, 2, -8273}, {0x3167, 2, -8096}, {0x3169, 1, -8093}, {0x316A, 1, -8092}, {0x316B, 1, -8088},
+    {0x316C, 1, -8085}, {0x316D, 1, -8084}, {0x316E, 1, -8274}, {0x316F, 1, -8082}, {0x3170, 1, -8081},
+    {0x3171, 2, -8276}, {0x3173, 1, -8275}, {0x3174, 2, -8274}, {0x3176, 1, -8271}, {0x3177, 1, -8270},
+    {0x3178, 5, -8269}, {0x317D, 1, -8267}, {0x317E, 1, -8264}, {0x317F, 1, -8255}, {0x3180, 1, -8249},
+    {0x3181, 1, -8245}, {0x3182, 2, -8081}, {0x3184, 3, -8237}, {0x3187, 2, -8195}, {0x3189, 1, -8193},
+    {0x318A, 2, -8185}, {0x318C, 1, -8184}, {0x318D, 1, -8175}, {0x318E, 1, -8173}, {0x3192, 1, 7278},
+    {0x3193, 1, 7417}, {0x3194, 1, 7285}, {0x3195, 1, 9542}, {0x3196, 1, 7284}, {0x3197, 1, 7318},
+    {0x3198, 1, 7283}, {0x3199, 1, 17305}, {0x319A, 1, 7359}, {0x319B, 1, 7294}, {0x319C, 1, 7269},
+    {0x319D, 1, 10124}, {0x319E, 1, 9618}, {0x319F, 1, 7451}, {0x3244, 1, 8971}, {0x3245, 1, 11319},
+    {0x3246, 1, 13121}, {0x3247, 1, 18760}, {0x3260, 1, -8544}, {0x3261, 2, -8543}, {0x3263, 3, -8542},
+    {0x3266, 1, -8541}, {0x3267, 2, -8540}, {0x3269, 5, -8539}, {0x3280, 1, 7040}, {0x3281, 1, 7179},
+    {0x3282, 1, 7047}, {0x3283, 1, 9304}, {0x3284, 1, 7184}, {0x3285, 1, 7912}, {0x3286, 1, 7037},
+    {0x3287, 1, 7908}, {0x3288, 1, 7125}, {0x3289, 1, 8376}, {0x328A, 1, 13438}, {0x328B, 1, 15840},
+    {0x328C, 1, 14760}, {0x328D, 1, 13467}, {0x328E, 1, 24387}, {0x328F, 1, 9360}, {0x3290, 1, 13141},
+    {0x3291, 1, 13721}, {0x3292, 1, 13431}, {0x3293, 1, 18091}, {0x3294, 1, 8569}, {0x3295, 1, 16356},
+    {0x3296, 1, 23051}, {0x3297, 1, 18118}, {0x3298, 1, 8220}, {0x3299, 1, 18239}, {0x329A, 1, 17053},
+    {0x329B, 1, 9944}, {0x329C, 1, 24013}, {0x329D, 1, 7821}, {0x329E, 1, 8402}, {0x329F, 1, 14921},
+    {0x32A0, 1, 25957}, {0x32A1, 1, 7280}, {0x32A2, 1, 7927}, {0x32A3, 1, 14528}, {0x32A4, 1, 7014},
+    {0x32A5, 1, 7048}, {0x32A6, 1, 7013}, {0x32A7, 1, 11071}, {0x32A8, 1, 8523}, {0x32A9, 1, 8338},
+    {0x32AA, 1, 10477}, {0x32AB, 1, 10427}, {0x32AC, 1, 17463}, {0x32AD, 1, 7252}, {0x32AE, 1, 23065},
+    {0x32AF, 1, 8357}, {0x32B0, 1, 9836}, {0x32D0, 1, -558}, {0x32D1, 1, -557}, {0x32D2, 1, -556},
+    {0x32D3, 1, -555}, {0x32D4, 2, -554}, {0x32D6, 1, -553}, {0x32D7, 1, -552}, {0x32D8, 1, -551},
+    {0x32D9, 1, -550}, {0x32DA, 1, -549}, {0x32DB, 1, -548}, {0x32DC, 1, -547}, {0x32DD, 1, -546},
+    {0x32DE, 1, -545}, {0x32DF, 1, -544}, {0x32E0, 1, -543}, {0x32E1, 1, -541}, {0x32E2, 1, -540},
+    {0x32E3, 1, -539}, {0x32E4, 6, -538}, {0x32EA, 1, -536}, {0x32EB, 1, -534}, {0x32EC, 1, -532},
+    {0x32ED, 1, -530}, {0x32EE, 5, -528}, {0x32F3, 1, -527}, {0x32F4, 1, -526}, {0x32F5, 6, -525},
+    {0x32FB, 4, -524}, {0xA69C, 1, -41554}, {0xA69D, 1, -41553}, {0xA770, 1, -1}, {0xA7F2, 1, -42927},
+    {0xA7F3, 1, -42925}, {0xA7F4, 1, -42915}, {0xA7F8, 1, -42706}, {0xA7F9, 1, -42662}, {0xAB5C, 1, -1077},
+    {0xAB5D, 1, -38}, {0xAB5E, 1, -43251}, {0xAB5F, 1, -13}, {0xAB69, 1, -43228}, {0xFB20, 1, -62782},
+    {0xFB21, 1, -62801}, {0xFB22, 2, -62799}, {0xFB24, 3, -62793}, {0xFB27, 1, -62783}, {0xFB28, 1, -62782},
+    {0xFB29, 1, -64254}, {0xFB50, 1, -62687}, {0xFB51, 1, -62688}, {0xFB52, 1, -62679}, {0xFB53, 1, -62680},
+    {0xFB54, 1, -62681}, {0xFB55, 1, -62682}, {0xFB56, 1, -62680}, {0xFB57, 1, -62681}, {0xFB58, 1, -62682},
+    {0xFB59, 1, -62683}, {0xFB5A, 1, -62682}, {0xFB5B, 1, -62683}, {0xFB5C, 1, -62684}, {0xFB5D, 1, -62685},
+    {0xFB5E, 1, -62692}, {0xFB5F, 1, -62693}, {0xFB60, 1, -62694}, {0xFB61, 1, -62695}, {0xFB62, 1, -62691},
+    {0xFB63, 1, -62692}, {0xFB64, 1, -62693}, {0xFB65, 1, -62694}, {0xFB66, 1, -62701}, {0xFB67, 1, -62702},
+    {0xFB68, 1, -62703}, {0xFB69, 1, -62704}, {0xFB6A, 1, -62662}, {0xFB6B, 1, -62663}, {0xFB6C, 1, -62664},
+    {0xFB6D, 1, -62665}, {0xFB6E, 1, -62664}, {0xFB6F, 1, -62665}, {0xFB70, 1, -62666}, {0xFB71, 1, -62667},
+    {0xFB72, 1, -62702}, {0xFB73, 1, -62703}, {0xFB74, 1, -62704}, {0xFB75, 1, -62705}, {0xFB76, 1, -62707},
+    {0xFB77, 1, -62708}, {0xFB78, 1, -62709}, {0xFB79, 1, -62710}, {0xFB7A, 1, -62708}, {0xFB7B, 1, -62709},
+    {0xFB7C, 1, -62710}, {0xFB7D, 2, -62711}, {0xFB7F, 1, -62712}, {0xFB80, 1, -62713}, {0xFB81, 1, -62714},
+    {0xFB82, 1, -62709}, {0xFB83, 1, -62710}, {0xFB84, 1, -62712}, {0xFB85, 1, -62713}, {0xFB86, 1, -62712},
+    {0xFB87, 1, -62713}, {0xFB88, 1, -62720}, {0xFB89, 1, -62721}, {0xFB8A, 1, -62706}, {0xFB8B, 1, -62707},
+    {0xFB8C, 1, -62715}, {0xFB8D, 1, -62716}, {0xFB8E, 1, -62693}, {0xFB8F, 1, -62694}, {0xFB90, 1, -62695},
+    {0xFB91, 1, -62696}, {0xFB92, 1, -62691}, {0xFB93, 1, -62692}, {0xFB94, 1, -62693}, {0xFB95, 1, -62694},
+    {0xFB96, 1, -62691}, {0xFB97, 1, -62692}, {0xFB98, 1, -62693}, {0xFB99, 1, -62694}, {0xFB9A, 1, -62697},
+    {0xFB9B, 1, -62698}, {0xFB9C, 1, -62699}, {0xFB9D, 1, -62700}, {0xFB9E, 1, -62692}, {0xFB9F, 2, -62693},
+    {0xFBA1, 1, -62694}, {0xFBA2, 1, -62695}, {0xFBA3, 1, -62696}, {0xFBA4, 1, -62692}, {0xFBA5, 2, -62693},
+    {0xFBA7, 1, -62694}, {0xFBA8, 1, -62695}, {0xFBA9, 1, -62696}, {0xFBAA, 1, -62700}, {0xFBAB, 1, -62701},
+    {0xFBAC, 1, -62702}, {0xFBAD, 1, -62703}, {0xFBAE, 1, -62684}, {0xFBAF, 2, -62685}, {0xFBB1, 1, -62686},
+    {0xFBD3, 1, -62758}, {0xFBD4, 1, -62759}, {0xFBD5, 1, -62760}, {0xFBD6, 1, -62761}, {0xFBD7, 1, -62736},
+    {0xFBD8, 1, -62737}, {0xFBD9, 1, -62739}, {0xFBDA, 1, -62740}, {0xFBDB, 1, -62739}, {0xFBDC, 1, -62740},
+    {0xFBDD, 1, -62822}, {0xFBDE, 1, -62739}, {0xFBDF, 1, -62740}, {0xFBE0, 1, -62747}, {0xFBE1, 1, -62748},
+    {0xFBE2, 1, -62745}, {0xFBE3, 1, -62746}, {0xFBE4, 1, -62740}, {0xFBE5, 1, -62741}, {0xFBE6, 1, -62742},
+    {0xFBE7, 1, -62743}, {0xFBE8, 1, -62879}, {0xFBE9, 1, -62880}, {0xFBFC, 1, -62768}, {0xFBFD, 1, -62769},
+    {0xFBFE, 1, -62770}, {0xFBFF, 1, -62771}, {0xFE10, 1, -64996}, {0xFE11, 2, -52752}, {0xFE13, 2, -64985},
+    {0xFE15, 1, -65012}, {0xFE16, 1, -64983}, {0xFE17, 2, -52737}, {0xFE19, 1, -56819}, {0xFE30, 1, -56843},
+    {0xFE31, 1, -56861}, {0xFE32, 1, -56863}, {0xFE33, 1, -64980}, {0xFE34, 1, -64981}, {0xFE35, 2, -65037},
+    {0xFE37, 1, -64956}, {0xFE38, 1, -64955}, {0xFE39, 2, -52773}, {0xFE3B, 2, -52779}, {0xFE3D, 2, -52787},
+    {0xFE3F, 2, -52791}, {0xFE41, 4, -52789}, {0xFE47, 1, -65004}, {0xFE48, 1, -65003}, {0xFE49, 1, -56843},
+    {0xFE4A, 1, -56844}, {0xFE4B, 1, -56845}, {0xFE4C, 1, -56846}, {0xFE4D, 1, -65006}, {0xFE4E, 1, -65007},
+    {0xFE4F, 1, -65008}, {0xFE50, 1, -65060}, {0xFE51, 1, -52816}, {0xFE52, 1, -65060}, {0xFE54, 1, -65049},
+    {0xFE55, 1, -65051}, {0xFE56, 1, -65047}, {0xFE57, 1, -65078}, {0xFE58, 1, -56900}, {0xFE59, 2, -65073},
+    {0xFE5B, 1, -64992}, {0xFE5C, 1, -64991}, {0xFE5D, 2, -52809}, {0xFE5F, 1, -65084}, {0xFE60, 1, -65082},
+    {0xFE61, 2, -65079}, {0xFE63, 1, -65078}, {0xFE64, 1, -65064}, {0xFE65, 1, -65063}, {0xFE66, 1, -65065},
+    {0xFE68, 1, -65036}, {0xFE69, 2, -65093}, {0xFE6B, 1, -65067}, {0xFE80, 2, -63583}, {0xFE82, 2, -63584},
+    {0xFE84, 2, -63585}, {0xFE86, 2, -63586}, {0xFE88, 2, -63587}, {0xFE8A, 1, -63588}, {0xFE8B, 1, -63589},
+    {0xFE8C, 2, -63590}, {0xFE8E, 2, -63591}, {0xFE90, 1, -63592}, {0xFE91, 1, -63593}, {0xFE92, 2, -63594},
+    {0xFE94, 2, -63595}, {0xFE96, 1, -63596}, {0xFE97, 1, -63597}, {0xFE98, 2, -63598}, {0xFE9A, 1, -63599},
+    {0xFE9B, 1, -63600}, {0xFE9C, 2, -63601}, {0xFE9E, 1, -63602}, {0xFE9F, 1, -63603}, {0xFEA0, 2, -63604},
+    {0xFEA2, 1, -63605}, {0xFEA3, 1, -63606}, {0xFEA4, 2, -63607}, {0xFEA6, 1, -63608}, {0xFEA7, 1, -63609},
+    {0xFEA8, 2, -63610}, {0xFEAA, 2, -63611}, {0xFEAC, 2, -63612}, {0xFEAE, 2, -63613}, {0xFEB0, 2, -63614},
+    {0xFEB2, 1, -63615}, {0xFEB3, 1, -63616}, {0xFEB4, 2, -63617}, {0xFEB6, 1, -63618}, {0xFEB7, 1, -63619},
+    {0xFEB8, 2, -63620}, {0xFEBA, 1, -63621}, {0xFEBB, 1, -63622}, {0xFEBC, 2, -63623}, {0xFEBE, 1, -63624},
+    {0xFEBF, 1, -63625}, {0xFEC0, 2, -63626}, {0xFEC2, 1, -63627}, {0xFEC3, 1, -63628}, {0xFEC4, 2, -63629},
+    {0xFEC6, 1, -63630}, {0xFEC7, 1, -63631}, {0xFEC8, 2, -63632}, {0xFECA, 1, -63633}, {0xFECB, 1, -63634},
+    {0xFECC, 2, -63635}, {0xFECE, 1, -63636}, {0xFECF, 1, -63637}, {0xFED0, 1, -63638}, {0xFED1, 1, -63632},
+    {0xFED2, 1, -63633}, {0xFED3, 1, -63634}, {0xFED4, 2, -63635}, {0xFED6, 1, -63636}, {0xFED7, 1, -63637},
+    {0xFED8, 2, -63638}, {0xFEDA, 1, -63639}, {0xFEDB, 1, -63640}, {0xFEDC, 2, -63641}, {0xFEDE, 1, -63642},
+    {0xFEDF, 1, -63643}, {0xFEE0, 2, -63644}, {0xFEE2, 1, -63645}, {0xFEE3, 1, -63646}, {0xFEE4, 2, -63647},
+    {0xFEE6, 1, -63648}, {0xFEE7, 1, -63649}, {0xFEE8, 2, -63650}, {0xFEEA, 1, -63651}, {0xFEEB, 1, -63652},
+    {0xFEEC, 2, -63653}, {0xFEEE, 2, -63654}, {0xFEF0, 2, -63655}, {0xFEF2, 1, -63656}, {0xFEF3, 1, -63657},
+    {0xFEF4, 1, -63658}, {0xFF01, 94, -65248}, {0xFF5F, 2, -54746}, {0xFF61, 1, -53087}, {0xFF62, 2, -53078},
+    {0xFF64, 1, -53091}, {0xFF65, 1, -52842}, {0xFF66, 1, -52852}, {0xFF67, 1, -52934}, {0xFF68, 1, -52933},
+    {0xFF69, 1, -52932}, {0xFF6A, 1, -52931}, {0xFF6B, 1, -52930}, {0xFF6C, 1, -52873}, {0xFF6D, 1, -52872},
+    {0xFF6E, 1, -52871}, {0xFF6F, 1, -52908}, {0xFF70, 1, -52852}, {0xFF71, 1, -52943}, {0xFF72, 1, -52942},
+    {0xFF73, 1, -52941}, {0xFF74, 1, -52940}, {0xFF75, 2, -52939}, {0xFF77, 1, -52938}, {0xFF78, 1, -52937},
+    {0xFF79, 1, -52936}, {0xFF7A, 1, -52935}, {0xFF7B, 1, -52934}, {0xFF7C, 1, -52933}, {0xFF7D, 1, -52932},
+    {0xFF7E, 1, -52931}, {0xFF7F, 1, -52930}, {0xFF80, 1, -52929}, {0xFF81, 1, -52928}, {0xFF82, 1, -52926},
+    {0xFF83, 1, -52925}, {0xFF84, 1, -52924}, {0xFF85, 6, -52923}, {0xFF8B, 1, -52921}, {0xFF8C, 1, -52919},
+    {0xFF8D, 1, -52917}, {0xFF8E, 1, -52915}, {0xFF8F, 5, -52913}, {0xFF94, 1, -52912}, {0xFF95, 1, -52911},
+    {0xFF96, 6, -52910}, {0xFF9C, 1, -52909}, {0xFF9D, 1, -52906}, {0xFF9E, 2, -52997}, {0xFFA0, 1, -52796},
+    {0xFFA1, 30, -52848}, {0xFFC2, 6, -52851}, {0xFFCA, 6, -52853}, {0xFFD2, 6, -52855}, {0xFFDA, 3, -52857},
+    {0xFFE0, 2, -65342}, {0xFFE2, 1, -65334}, {0xFFE3, 1, -65332}, {0xFFE4, 1, -65342}, {0xFFE5, 1, -65344},
+    {0xFFE6, 1, -57149}, {0xFFE8, 1, -56038}, {0xFFE9, 4, -56921}, {0xFFED, 1, -55885}, {0xFFEE, 1, -55843},
+    {0x10781, 2, -66737}, {0x10783, 1, -67229}, {0x10784, 1, -66795}, {0x10785, 1, -66866}, {0x10787, 1, -66788},
+    {0x10788, 1, -23586}, {0x10789, 1, -66788}, {0x1078A, 1, -66790}, {0x1078B, 2, -66869}, {0x1078D, 1, -59900},
+    {0x1078E, 1, -66870}, {0x1078F, 1, -66865}, {0x10790, 1, -66791}, {0x10791, 1, -66861}, {0x10792, 1, -66864},
+    {0x10793, 1, -66867}, {0x10794, 1, -66809}, {0x10795, 1, -67182}, {0x10796, 1, -66810}, {0x10797, 1, -66864},
+    {0x10798, 1, -66836}, {0x10799, 2, -66799}, {0x1079B, 1, -66863}, {0x1079C, 1, 55144}, {0x1079D, 1, -24591},
+    {0x1079E, 1, -66864}, {0x1079F, 1, 55142}, {0x107A0, 1, -66834}, {0x107A1, 1, 55141}, {0x107A2, 1, -67242},
+    {0x107A3, 2, -66861}, {0x107A5, 1, -67380}, {0x107A6, 1, -66860}, {0x107A7, 1, 55137}, {0x107A8, 2, -66859},
+    {0x107AA, 1, -66858}, {0x107AB, 1, -66819}, {0x107AC, 1, -66822}, {0x107AD, 1, -23622}, {0x107AE, 1, -66823},
+    {0x107AF, 1, -66855}, {0x107B0, 1, -56127}, {0x107B2, 1, -66851}, {0x107B3, 2, -66834}, {0x107B5, 1, -66845},
+    {0x107B6, 3, -67062}, {0x107B9, 1, 55121}, {0x107BA, 1, 55140}, {0x1D400, 26, -119743}, {0x1D41A, 26, -119737},
+    {0x1D434, 26, -119795}, {0x1D44E, 7, -119789}, {0x1D456, 18, -119789}, {0x1D468, 26, -119847}, {0x1D482, 26, -119841},
+    {0x1D49C, 1, -119899}, {0x1D49E, 2, -119899}, {0x1D4A2, 1, -119899}, {0x1D4A5, 2, -119899}, {0x1D4A9, 4, -119899},
+    {0x1D4AE, 8, -119899}, {0x1D4B6, 4, -119893}, {0x1D4BB, 1, -119893}, {0x1D4BD, 7, -119893}, {0x1D4C5, 11, -119893},
+    {0x1D4D0, 26, -119951}, {0x1D4EA, 26, -119945}, {0x1D504, 2, -120003}, {0x1D507, 4, -120003}, {0x1D50D, 8, -120003},
+    {0x1D516, 7, -120003}, {0x1D51E, 26, -119997}, {0x1D538, 2, -120055}, {0x1D53B, 4, -120055}, {0x1D540, 5, -120055},
+    {0x1D546, 1, -120055}, {0x1D54A, 7, -120055}, {0x1D552, 26, -120049}, {0x1D56C, 26, -120107}, {0x1D586, 26, -120101},
+    {0x1D5A0, 26, -120159}, {0x1D5BA, 26, -120153}, {0x1D5D4, 26, -120211}, {0x1D5EE, 26, -120205}, {0x1D608, 26, -120263},
+    {0x1D622, 26, -120257}, {0x1D63C, 26, -120315}, {0x1D656, 26, -120309}, {0x1D670, 26, -120367}, {0x1D68A, 26, -120361},
+    {0x1D6A4, 1, -120179}, {0x1D6A5, 1, -119918}, {0x1D6A8, 17, -119575}, {0x1D6B9, 1, -119493}, {0x1D6BA, 7, -119575},
+    {0x1D6C1, 1, -111802}, {0x1D6C2, 25, -119569}, {0x1D6DB, 1, -111833}, {0x1D6DC, 1, -119527}, {0x1D6DD, 1, -119564},
+    {0x1D6DE, 1, -119534}, {0x1D6DF, 1, -119562}, {0x1D6E0, 1, -119535}, {0x1D6E1, 1, -119563}, {0x1D6E2, 17, -119633},
+    {0x1D6F3, 1, -119551}, {0x1D6F4, 7, -119633}, {0x1D6FB, 1, -111860}, {0x1D6FC, 25, -119627}, {0x1D715, 1, -111891},
+    {0x1D716, 1, -119585}, {0x1D717, 1, -119622}, {0x1D718, 1, -119592}, {0x1D719, 1, -119620}, {0x1D71A, 1, -119593},
+    {0x1D71B, 1, -119621}, {0x1D71C, 17, -119691}, {0x1D72D, 1, -119609}, {0x1D72E, 7, -119691}, {0x1D735, 1, -111918},
+    {0x1D736, 25, -119685}, {0x1D74F, 1, -111949}, {0x1D750, 1, -119643}, {0x1D751, 1, -119680}, {0x1D752, 1, -119650},
+    {0x1D753, 1, -119678}, {0x1D754, 1, -119651}, {0x1D755, 1, -119679}, {0x1D756, 17, -119749}, {0x1D767, 1, -119667},
+    {0x1D768, 7, -119749}, {0x1D76F, 1, -111976}, {0x1D770, 25, -119743}, {0x1D789, 1, -112007}, {0x1D78A, 1, -119701},
+    {0x1D78B, 1, -119738}, {0x1D78C, 1, -119708}, {0x1D78D, 1, -119736}, {0x1D78E, 1, -119709}, {0x1D78F, 1, -119737},
+    {0x1D790, 17, -119807}, {0x1D7A1, 1, -119725}, {0x1D7A2, 7, -119807}, {0x1D7A9, 1, -112034}, {0x1D7AA, 25, -119801},
+    {0x1D7C3, 1, -112065}, {0x1D7C4, 1, -119759}, {0x1D7C5, 1, -119796}, {0x1D7C6, 1, -119766}, {0x1D7C7, 1, -119794},
+    {0x1D7C8, 1, -119767}, {0x1D7C9, 1, -119795}, {0x1D7CA, 2, -119790}, {0x1D7CE, 10, -120734}, {0x1D7D8, 10, -120744},
+    {0x1D7E2, 10, -120754}, {0x1D7EC, 10, -120764}, {0x1D7F6, 10, -120774}, {0x1EE00, 2, -124889}, {0x1EE02, 1, -124886},
+    {0x1EE03, 1, -124884}, {0x1EE05, 1, -124861}, {0x1EE06, 1, -124884}, {0x1EE07, 1, -124890}, {0x1EE08, 1, -124881},
+    {0x1EE09, 1, -124863}, {0x1EE0A, 4, -124871}, {0x1EE0E, 1, -124891}, {0x1EE0F, 1, -124886}, {0x1EE10, 1, -124879},
+    {0x1EE11, 1, -124892}, {0x1EE12, 1, -124880}, {0x1EE13, 1, -124898}, {0x1EE14, 1, -124896}, {0x1EE15, 2, -124907},
+    {0x1EE17, 1, -124905}, {0x1EE18, 1, -124904}, {0x1EE19, 1, -124899}, {0x1EE1A, 1, -124898}, {0x1EE1B, 1, -124897},
+    {0x1EE1C, 1, -124846}, {0x1EE1D, 1, -124771}, {0x1EE1E, 1, -124797}, {0x1EE1F, 1, -124848}, {0x1EE21, 1, -124921},
+    {0x1EE22, 1, -124918}, {0x1EE24, 1, -124893}, {0x1EE27, 1, -124922}, {0x1EE29, 1, -124895}, {0x1EE2A, 4, -124903},
+    {0x1EE2E, 1, -124923}, {0x1EE2F, 1, -124918}, {0x1EE30, 1, -124911}, {0x1EE31, 1, -124924}, {0x1EE32, 1, -124912},
+    {0x1EE34, 1, -124928}, {0x1EE35, 2, -124939}, {0x1EE37, 1, -124937}, {0x1EE39, 1, -124931}, {0x1EE3B, 1, -124929},
+    {0x1EE42, 1, -124950}, {0x1EE47, 1, -124954}, {0x1EE49, 1, -124927}, {0x1EE4B, 1, -124935}, {0x1EE4D, 1, -124935},
+    {0x1EE4E, 1, -124955}, {0x1EE4F, 1, -124950}, {0x1EE51, 1, -124956}, {0x1EE52, 1, -124944}, {0x1EE54, 1, -124960},
+    {0x1EE57, 1, -124969}, {0x1EE59, 1, -124963}, {0x1EE5B, 1, -124961}, {0x1EE5D, 1, -124835}, {0x1EE5F, 1, -124912},
+    {0x1EE61, 1, -124985}, {0x1EE62, 1, -124982}, {0x1EE64, 1, -124957}, {0x1EE67, 1, -124986}, {0x1EE68, 1, -124977},
+    {0x1EE69, 1, -124959}, {0x1EE6A, 1, -124967}, {0x1EE6C, 2, -124967}, {0x1EE6E, 1, -124987}, {0x1EE6F, 1, -124982},
+    {0x1EE70, 1, -124975}, {0x1EE71, 1, -124988}, {0x1EE72, 1, -124976}, {0x1EE74, 1, -124992}, {0x1EE75, 2, -125003},
+    {0x1EE77, 1, -125001}, {0x1EE79, 1, -124995}, {0x1EE7A, 1, -124994}, {0x1EE7B, 1, -124993}, {0x1EE7C, 1, -124942},
+    {0x1EE7E, 1, -124893}, {0x1EE80, 2, -125017}, {0x1EE82, 1, -125014}, {0x1EE83, 1, -125012}, {0x1EE84, 2, -124989},
+    {0x1EE86, 1, -125012}, {0x1EE87, 1, -125018}, {0x1EE88, 1, -125009}, {0x1EE89, 1, -124991}, {0x1EE8B, 3, -124999},
+    {0x1EE8E, 1, -125019}, {0x1EE8F, 1, -125014}, {0x1EE90, 1, -125007}, {0x1EE91, 1, -125020}, {0x1EE92, 1, -125008},
+    {0x1EE93, 1, -125026}, {0x1EE94, 1, -125024}, {0x1EE95, 2, -125035}, {0x1EE97, 1, -125033}, {0x1EE98, 1, -125032},
+    {0x1EE99, 1, -125027}, {0x1EE9A, 1, -125026}, {0x1EE9B, 1, -125025}, {0x1EEA1, 1, -125049}, {0x1EEA2, 1, -125046},
+    {0x1EEA3, 1, -125044}, {0x1EEA5, 1, -125021}, {0x1EEA6, 1, -125044}, {0x1EEA7, 1, -125050}, {0x1EEA8, 1, -125041},
+    {0x1EEA9, 1, -125023}, {0x1EEAB, 3, -125031}, {0x1EEAE, 1, -125051}, {0x1EEAF, 1, -125046}, {0x1EEB0, 1, -125039},
+    {0x1EEB1, 1, -125052}, {0x1EEB2, 1, -125040}, {0x1EEB3, 1, -125058}, {0x1EEB4, 1, -125056}, {0x1EEB5, 2, -125067},
+    {0x1EEB7, 1, -125065}, {0x1EEB8, 1, -125064}, {0x1EEB9, 1, -125059}, {0x1EEBA, 1, -125058}, {0x1EEBB, 1, -125057},
+    {0x1F12B, 1, -127208}, {0x1F12C, 1, -127194}, {0x1F130, 26, -127215}, {0x1F202, 1, -115021}, {0x1F210, 1, -102341},
+    {0x1F211, 1, -104122}, {0x1F212, 1, -106054}, {0x1F213, 1, -115020}, {0x1F214, 1, -107400}, {0x1F215, 1, -104699},
+    {0x1F216, 1, -92211}, {0x1F217, 1, -104686}, {0x1F218, 1, -107380}, {0x1F219, 1, -101369}, {0x1F21A, 1, -98553},
+    {0x1F21B, 1, -101506}, {0x1F21C, 1, -106447}, {0x1F21D, 1, -103057}, {0x1F21E, 1, -106641}, {0x1F21F, 1, -101487},
+    {0x1F220, 1, -106499}, {0x1F221, 1, -95455}, {0x1F222, 1, -97539}, {0x1F223, 1, -91514}, {0x1F224, 1, -104756},
+    {0x1F225, 1, -105964}, {0x1F226, 1, -99090}, {0x1F227, 1, -102290}, {0x1F228, 1, -102099}, {0x1F229, 1, -107561},
+    {0x1F22A, 1, -107553}, {0x1F22B, 1, -90593}, {0x1F22C, 1, -103494}, {0x1F22D, 1, -107520}, {0x1F22E, 1, -106043},
+    {0x1F22F, 1, -102184}, {0x1F230, 1, -91328}, {0x1F231, 1, -102366}, {0x1F232, 1, -96433}, {0x1F233, 1, -96185},
+    {0x1F234, 1, -106028}, {0x1F235, 1, -99253}, {0x1F236, 1, -101165}, {0x1F237, 1, -101167}, {0x1F238, 1, -97541},
+    {0x1F239, 1, -106439}, {0x1F23A, 1, -105604}, {0x1F23B, 1, -90350}, {0x1F250, 1, -103097}, {0x1F251, 1, -106082},
+    {0x1FBF0, 10, -129984},
+};
+static const CompatDecomposition kCompatDecompositions[] = {
+    {0x00A8, {0x0020, 0x0308}}, {0x00AF, {0x0020, 0x0304}}, {0x00B4, {0x0020, 0x0301}},
+    {0x00B8, {0x0020, 0x0327}}, {0x00BC, {0x0031, 0x2044, 0x0034}}, {0x00BD, {0x0031, 0x2044, 0x0032}},
+    {0x00BE, {0x0033, 0x2044, 0x0034}}, {0x0132, {0x0049, 0x004A}}, {0x0133, {0x0069, 0x006A}},
+    {0x013F, {0x004C, 0x00B7}}, {0x0140, {0x006C, 0x00B7}}, {0x0149, {0x02BC, 0x006E}},
+    {0x01C4, {0x0044, 0x017D}}, {0x01C5, {0x0044, 0x017E}}, {0x01C6, {0x0064, 0x017E}},
+    {0x01C7, {0x004C, 0x004A}}, {0x01C8, {0x004C, 0x006A}}, {0x01C9, {0x006C, 0x006A}},
+    {0x01CA, {0x004E, 0x004A}}, {0x01CB, {0x004E, 0x006A}}, {0x01CC, {0x006E, 0x006A}},
+    {0x01F1, {0x0044, 0x005A}}, {0x01F2, {0x0044, 0x007A}}, {0x01F3, {0x0064, 0x007A}},
+    {0x02D8, {0x0020, 0x0306}}, {0x02D9, {0x0020, 0x0307}}, {0x02DA, {0x0020, 0x030A}},
+    {0x02DB, {0x0020, 0x0328}}, {0x02DC, {0x0020, 0x0303}}, {0x02DD, {0x0020, 0x030B}},
+    {0x037A, {0x0020, 0x0345}}, {0x0384, {0x0020, 0x0301}}, {0x0587, {0x0565, 0x0582}},
+    {0x0675, {0x0627, 0x0674}}, {0x0676, {0x0648, 0x0674}}, {0x0677, {0x06C7, 0x0674}},
+    {0x0678, {0x064A, 0x0674}}, {0x0E33, {0x0E4D, 0x0E32}}, {0x0EB3, {0x0ECD, 0x0EB2}},
+    {0x0EDC, {0x0EAB, 0x0E99}}, {0x0EDD, {0x0EAB, 0x0EA1}}, {0x0F77, {0x0FB2, 0x0F81}},
+    {0x0F79, {0x0FB3, 0x0F81}}, {0x1E9A, {0x0061, 0x02BE}}, {0x1FBD, {0x0020, 0x0313}},
+    {0x1FBF, {0x0020, 0x0313}}, {0x1FC0, {0x0020, 0x0342}}, {0x1FFE, {0x0020, 0x0314}},
+    {0x2017, {0x0020, 0x0333}}, {0x2025, {0x002E, 0x002E}}, {0x2026, {0x002E, 0x002E, 0x002E}},
+    {0x2033, {0x2032, 0x2032}}, {0x2034, {0x2032, 0x2032, 0x2032}}, {0x2036, {0x2035, 0x2035}},
+    {0x2037, {0x2035, 0x2035, 0x2035}}, {0x203C, {0x0021, 0x0021}}, {0x203E, {0x0020, 0x0305}},
+    {0x2047, {0x003F, 0x003F}}, {0x2048, {0x003F, 0x0021}}, {0x2049, {0x0021, 0x003F}},
+    {0x2057, {0x2032, 0x2032, 0x2032, 0x2032}}, {0x20A8, {0x0052, 0x0073}}, {0x2100, {0x0061, 0x002F, 0x0063}},
+    {0x2101, {0x0061, 0x002F, 0x0073}}, {0x2103, {0x00B0, 0x0043}}, {0x2105, {0x0063, 0x002F, 0x006F}},
+    {0x2106, {0x0063, 0x002F, 0x0075}}, {0x2109, {0x00B0, 0x0046}}, {0x2116, {0x004E, 0x006F}},
+    {0x2120, {0x0053, 0x004D}}, {0x2121, {0x0054, 0x0045, 0x004C}}, {0x2122, {0x0054, 0x004D}},
+    {0x213B, {0x0046, 0x0041, 0x0058}}, {0x2150, {0x0031, 0x2044, 0x0037}}, {0x2151, {0x0031, 0x2044, 0x0039}},
+    {0x2152, {0x0031, 0x2044, 0x0031, 0x0030}}, {0x2153, {0x0031, 0x2044, 0x0033}}, {0x2154, {0x0032, 0x2044, 0x0033}},
+    {0x2155, {0x0031, 0x2044, 0x0035}}, {0x2156, {0x0032, 0x2044, 0x0035}}, {0x2157, {0x0033, 0x2044, 0x0035}},
+    {0x2158, {0x0034, 0x2044, 0x0035}}, {0x2159, {0x0031, 0x2044, 0x0036}}, {0x215A, {0x0035, 0x2044, 0x0036}},
+    {0x215B, {0x0031, 0x2044, 0x0038}}, {0x215C, {0x0033, 0x2044, 0x0038}}, {0x215D, {0x0035, 0x2044, 0x0038}},
+    {0x215E, {0x0037, 0x2044, 0x0038}}, {0x215F, {0x0031, 0x2044}}, {0x2161, {0x0049, 0x0049}},
+    {0x2162, {0x0049, 0x0049, 0x0049}}, {0x2163, {0x0049, 0x0056}}, {0x2165, {0x0056, 0x0049}},
+    {0x2166, {0x0056, 0x0049, 0x0049}}, {0x2167, {0x0056, 0x0049, 0x0049, 0x0049}}, {0x2168, {0x0049, 0x0058}},
+    {0x216A, {0x0058, 0x0049}}, {0x216B, {0x0058, 0x0049, 0x0049}}, {0x2171, {0x0069, 0x0069}},
+    {0x2172, {0x0069, 0x0069, 0x0069}}, {0x2173, {0x0069, 0x0076}}, {0x2175, {0x0076, 0x0069}},
+    {0x2176, {0x0076, 0x0069, 0x0069}}, {0x2177, {0x0076, 0x0069, 0x0069, 0x0069}}, {0x2178, {0x0069, 0x0078}},
+    {0x217A, {0x0078, 0x0069}}, {0x217B, {0x0078, 0x0069, 0x0069}}, {0x2189, {0x0030, 0x2044, 0x0033}},
+    {0x222C, {0x222B, 0x222B}}, {0x222D, {0x222B, 0x222B, 0x222B}}, {0x222F, {0x222E, 0x222E}},
+    {0x2230, {0x222E, 0x222E, 0x222E}}, {0x2469, {0x0031, 0x0030}}, {0x246A, {0x0031, 0x0031}},
+    {0x246B, {0x0031, 0x0032}}, {0x246C, {0x0031, 0x0033}}, {0x246D, {0x0031, 0x0034}},
+    {0x246E, {0x0031, 0x0035}}, {0x246F, {0x0031, 0x0036}}, {0x2470, {0x0031, 0x0037}},
+    {0x2471, {0x0031, 0x0038}}, {0x2472, {0x0031, 0x0039}}, {0x2473, {0x0032, 0x0030}},
+    {0x2474, {0x0028, 0x0031, 0x0029}}, {0x2475, {0x0028, 0x0032, 0x0029}}, {0x2476, {0x0028, 0x0033, 0x0029}},
+    {0x2477, {0x0028, 0x0034, 0x0029}}, {0x2478, {0x0028, 0x0035, 0x0029}}, {0x2479, {0x0028, 0x0036, 0x0029}},
+    {0x247A, {0x0028, 0x0037, 0x0029}}, {0x247B, {0x0028, 0x0038, 0x0029}}, {0x247C, {0x0028, 0x0039, 0x0029}},
+    {0x247D, {0x0028, 0x0031, 0x0030, 0x0029}}, {0x247E, {0x0028, 0x0031, 0x0031, 0x0029}}, {0x247F, {0x0028, 0x0031, 0x0032, 0x0029}},
+    {0x2480, {0x0028, 0x0031, 0x0033, 0x0029}}, {0x2481, {0x0028, 0x0031, 0x0034, 0x0029}}, {0x2482, {0x0028, 0x0031, 0x0035, 0x0029}},
+    {0x2483, {0x0028, 0x0031, 0x0036, 0x0029}}, {0x2484, {0x0028, 0x0031, 0x0037, 0x0029}}, {0x2485, {0x0028, 0x0031, 0x0038, 0x0029}},
+    {0x2486, {0x0028, 0x0031, 0x0039, 0x0029}}, {0x2487, {0x0028, 0x0032, 0x0030, 0x0029}}, {0x2488, {0x0031, 0x002E}},
+    {0x2489, {0x0032, 0x002E}}, {0x248A, {0x0033, 0x002E}}, {0x248B, {0x0034, 0x002E}},
+    {0x248C, {0x0035, 0x002E}}, {0x248D, {0x0036, 0x002E}}, {0x248E, {0x0037, 0x002E}},
+    {0x248F, {0x0038, 0x002E}}, {0x2490, {0x0039, 0x002E}}, {0x2491, {0x0031, 0x0030, 0x002E}},
+    {0x2492, {0x0031, 0x0031, 0x002E}}, {0x2493, {0x0031, 0x0032, 0x002E}}, {0x2494, {0x0031, 0x0033, 0x002E}},
+    {0x2495, {0x0031, 0x0034, 0x002E}}, {0x2496, {0x0031, 0x0035, 0x002E}}, {0x2497, {0x0031, 0x0036, 0x002E}},
+    {0x2498, {0x0031, 0x0037, 0x002E}}, {0x2499, {0x0031, 0x0038, 0x002E}}, {0x249A, {0x0031, 0x0039, 0x002E}},
+    {0x249B, {0x0032, 0x0030, 0x002E}}, {0x249C, {0x0028, 0x0061, 0x0029}}, {0x249D, {0x0028, 0x0062, 0x0029}},
+    {0x249E, {0x0028, 0x0063, 0x0029}}, {0x249F, {0x0028, 0x0064, 0x0029}}, {0x24A0, {0x0028, 0x0065, 0x0029}},
+    {0x24A1, {0x0028, 0x0066, 0x0029}}, {0x24A2, {0x0028, 0x0067, 0x0029}}, {0x24A3, {0x0028, 0x0068, 0x0029}},
+    {0x24A4, {0x0028, 0x0069, 0x0029}}, {0x24A5, {0x0028, 0x006A, 0x0029}}, {0x24A6, {0x0028, 0x006B, 0x0029}},
+    {0x24A7, {0x0028, 0x006C, 0x0029}}, {0x24A8, {0x0028, 0x006D, 0x0029}}, {0x24A9, {0x0028, 0x006E, 0x0029}},
+    {0x24AA, {0x0028, 0x006F, 0x0029}}, {0x24AB, {0x0028, 0x0070, 0x0029}}, {0x24AC, {0x0028, 0x0071, 0x0029}},
+    {0x24AD, {0x0028, 0x0072, 0x0029}}, {0x24AE, {0x0028, 0x0073, 0x0029}}, {0x24AF, {0x0028, 0x0074, 0x0029}},
+    {0x24B0, {0x0028, 0x0075, 0x0029}}, {0x24B1, {0x0028, 0x0076, 0x0029}}, {0x24B2, {0x0028, 0x0077, 0x0029}},
+    {0x24B3, {0x0028, 0x0078, 0x0029}}, {0x24B4, {0x0028, 0x0079, 0x0029}}, {0x24B5, {0x0028, 0x007A, 0x0029}},
+    {0x2A0C, {0x222B, 0x222B, 0x222B, 0x222B}}, {0x2A74, {0x003A, 0x003A, 0x003D}}, {0x2A75, {0x003D, 0x003D}},
+    {0x2A76, {0x003D, 0x003D, 0x003D}}, {0x309B, {0x0020, 0x3099}}, {0x309C, {0x0020, 0x309A}},
+    {0x309F, {0x3088, 0x308A}}, {0x30FF, {0x30B3, 0x30C8}}, {0x3200, {0x0028, 0x1100, 0x0029}},
+    {0x3201, {0x0028, 0x1102, 0x0029}}, {0x3202, {0x0028, 0x1103, 0x0029}}, {0x3203, {0x0028, 0x1105, 0x0029}},
+    {0x3204, {0x0028, 0x1106, 0x0029}}, {0x3205, {0x0028, 0x1107, 0x0029}}, {0x3206, {0x0028, 0x1109, 0x0029}},
+    {0x3207, {0x0028, 0x110B, 0x0029}}, {0x3208, {0x0028, 0x110C, 0x0029}}, {0x3209, {0x0028, 0x110E, 0x0029}},
+    {0x320A, {0x0028, 0x110F, 0x0029}}, {0x320B, {0x0028, 0x1110, 0x0029}}, {0x320C, {0x0028, 0x1111, 0x0029}},
+    {0x320D, {0x0028, 0x1112, 0x0029}}, {0x320E, {0x0028, 0x1100, 0x1161, 0x0029}}, {0x320F, {0x0028, 0x1102, 0x1161, 0x0029}},
+    {0x3210, {0x0028, 0x1103, 0x1161, 0x0029}}, {0x3211, {0x0028, 0x1105, 0x1161, 0x0029}}, {0x3212, {0x0028, 0x1106, 0x1161, 0x0029}},
+    {0x3213, {0x0028, 0x1107, 0x1161, 0x0029}}, {0x3214, {0x0028, 0x1109, 0x1161, 0x0029}}, {0x3215, {0x0028, 0x110B, 0x1161, 0x0029}},
+    {0x3216, {0x0028, 0x110C, 0x1161, 0x0029}}, {0x3217, {0x0028, 0x110E, 0x1161, 0x0029}}, {0x3218, {0x0028, 0x110F, 0x1161, 0x0029}},
+    {0x3219, {0x0028, 0x1110, 0x1161, 0x0029}}, {0x321A, {0x0028, 0x1111, 0x1161, 0x0029}}, {0x321B, {0x0028, 0x1112, 0x1161, 0x0029}},
+    {0x321C, {0x0028, 0x110C, 0x116E, 0x0029}}, {0x3220, {0x0028, 0x4E00, 0x0029}}, {0x3221, {0x0028, 0x4E8C, 0x0029}},
+    {0x3222, {0x0028, 0x4E09, 0x0029}}, {0x3223, {0x0028, 0x56DB, 0x0029}}, {0x3224, {0x0028, 0x4E94, 0x0029}},
+    {0x3225, {0x0028, 0x516D, 0x0029}}, {0x3226, {0x0028, 0x4E03, 0x0029}}, {0x3227, {0x0028, 0x516B, 0x0029}},
+    {0x3228, {0x0028, 0x4E5D, 0x0029}}, {0x3229, {0x0028, 0x5341, 0x0029}}, {0x322A, {0x0028, 0x6708, 0x0029}},
+    {0x322B, {0x0028, 0x706B, 0x0029}}, {0x322C, {0x0028, 0x6C34, 0x0029}}, {0x322D, {0x0028, 0x6728, 0x0029}},
+    {0x322E, {0x0028, 0x91D1, 0x0029}}, {0x322F, {0x0028, 0x571F, 0x0029}}, {0x3230, {0x0028, 0x65E5, 0x0029}},
+    {0x3231, {0x0028, 0x682A, 0x0029}}, {0x3232, {0x0028, 0x6709, 0x0029}}, {0x3233, {0x0028, 0x793E, 0x0029}},
+    {0x3234, {0x0028, 0x540D, 0x0029}}, {0x3235, {0x0028, 0x7279, 0x0029}}, {0x3236, {0x0028, 0x8CA1, 0x0029}},
+    {0x3237, {0x0028, 0x795D, 0x0029}}, {0x3238, {0x0028, 0x52B4, 0x0029}}, {0x3239, {0x0028, 0x4EE3, 0x0029}},
+    {0x323A, {0x0028, 0x547C, 0x0029}}, {0x323B, {0x0028, 0x5B66, 0x0029}}, {0x323C, {0x0028, 0x76E3, 0x0029}},
+    {0x323D, {0x0028, 0x4F01, 0x0029}}, {0x323E, {0x0028, 0x8CC7, 0x0029}}, {0x323F, {0x0028, 0x5354, 0x0029}},
+    {0x3240, {0x0028, 0x796D, 0x0029}}, {0x3241, {0x0028, 0x4F11, 0x0029}}, {0x3242, {0x0028, 0x81EA, 0x0029}},
+    {0x3243, {0x0028, 0x81F3, 0x0029}}, {0x3250, {0x0050, 0x0054, 0x0045}}, {0x3251, {0x0032, 0x0031}},
+    {0x3252, {0x0032, 0x0032}}, {0x3253, {0x0032, 0x0033}}, {0x3254, {0x0032, 0x0034}},
+    {0x3255, {0x0032, 0x0035}}, {0x3256, {0x0032, 0x0036}}, {0x3257, {0x0032, 0x0037}},
+    {0x3258, {0x0032, 0x0038}}, {0x3259, {0x0032, 0x0039}}, {0x325A, {0x0033, 0x0030}},
+    {0x325B, {0x0033, 0x0031}}, {0x325C, {0x0033, 0x0032}}, {0x325D, {0x0033, 0x0033}},
+    {0x325E, {0x0033, 0x0034}}, {0x325F, {0x0033, 0x0035}}, {0x326E, {0x1100, 0x1161}},
+    {0x326F, {0x1102, 0x1161}}, {0x3270, {0x1103, 0x1161}}, {0x3271, {0x1105, 0x1161}},
+    {0x3272, {0x1106, 0x1161}}, {0x3273, {0x1107, 0x1161}}, {0x3274, {0x1109, 0x1161}},
+    {0x3275, {0x110B, 0x1161}}, {0x3276, {0x110C, 0x1161}}, {0x3277, {0x110E, 0x1161}},
+    {0x3278, {0x110F, 0x1161}}, {0x3279, {0x1110, 0x1161}}, {0x327A, {0x1111, 0x1161}},
+    {0x327B, {0x1112, 0x1161}}, {0x327D, {0x110C, 0x116E, 0x110B, 0x1174}}, {0x327E, {0x110B, 0x116E}},
+    {0x32B1, {0x0033, 0x0036}}, {0x32B2, {0x0033, 0x0037}}, {0x32B3, {0x0033, 0x0038}},
+    {0x32B4, {0x0033, 0x0039}}, {0x32B5, {0x0034, 0x0030}}, {0x32B6, {0x0034, 0x0031}},
+    {0x32B7, {0x0034, 0x0032}}, {0x32B8, {0x0034, 0x0033}}, {0x32B9, {0x0034, 0x0034}},
+    {0x32BA, {0x0034, 0x0035}}, {0x32BB, {0x0034, 0x0036}}, {0x32BC, {0x0034, 0x0037}},
+    {0x32BD, {0x0034, 0x0038}}, {0x32BE, {0x0034, 0x0039}}, {0x32BF, {0x0035, 0x0030}},
+    {0x32C0, {0x0031, 0x6708}}, {0x32C1, {0x0032, 0x6708}}, {0x32C2, {0x0033, 0x6708}},
+    {0x32C3, {0x0034, 0x6708}}, {0x32C4, {0x0035, 0x6708}}, {0x32C5, {0x0036, 0x6708}},
+    {0x32C6, {0x0037, 0x6708}}, {0x32C7, {0x0038, 0x6708}}, {0x32C8, {0x0039, 0x6708}},
+    {0x32C9, {0x0031, 0x0030, 0x6708}}, {0x32CA, {0x0031, 0x0031, 0x6708}}, {0x32CB, {0x0031, 0x0032, 0x6708}},
+    {0x32CC, {0x0048, 0x0067}}, {0x32CD, {0x0065, 0x0072, 0x0067}}, {0x32CE, {0x0065, 0x0056}},
+    {0x32CF, {0x004C, 0x0054, 0x0044}}, {0x32FF, {0x4EE4, 0x548C}}, {0x3300, {0x30A2, 0x30D1, 0x30FC, 0x30C8}},
+    {0x3301, {0x30A2, 0x30EB, 0x30D5, 0x30A1}}, {0x3302, {0x30A2, 0x30F3, 0x30DA, 0x30A2}}, {0x3303, {0x30A2, 0x30FC, 0x30EB}},
+    {0x3304, {0x30A4, 0x30CB, 0x30F3, 0x30B0}}, {0x3305, {0x30A4, 0x30F3, 0x30C1}}, {0x3306, {0x30A6, 0x30A9, 0x30F3}},
+    {0x3308, {0x30A8, 0x30FC, 0x30AB, 0x30FC}}, {0x3309, {0x30AA, 0x30F3, 0x30B9}}, {0x330A, {0x30AA, 0x30FC, 0x30E0}},
+    {0x330B, {0x30AB, 0x30A4, 0x30EA}}, {0x330C, {0x30AB, 0x30E9, 0x30C3, 0x30C8}}, {0x330D, {0x30AB, 0x30ED, 0x30EA, 0x30FC}},
+    {0x330E, {0x30AC, 0x30ED, 0x30F3}}, {0x330F, {0x30AC, 0x30F3, 0x30DE}}, {0x3310, {0x30AE, 0x30AC}},
+    {0x3311, {0x30AE, 0x30CB, 0x30FC}}, {0x3312, {0x30AD, 0x30E5, 0x30EA, 0x30FC}}, {0x3313, {0x30AE, 0x30EB, 0x30C0, 0x30FC}},
+    {0x3314, {0x30AD, 0x30ED}}, {0x3318, {0x30B0, 0x30E9, 0x30E0}}, {0x331B, {0x30AF, 0x30ED, 0x30FC, 0x30CD}},
+    {0x331C, {0x30B1, 0x30FC, 0x30B9}}, {0x331D, {0x30B3, 0x30EB, 0x30CA}}, {0x331E, {0x30B3, 0x30FC, 0x30DD}},
+    {0x331F, {0x30B5, 0x30A4, 0x30AF, 0x30EB}}, {0x3321, {0x30B7, 0x30EA, 0x30F3, 0x30B0}}, {0x3322, {0x30BB, 0x30F3, 0x30C1}},
+    {0x3323, {0x30BB, 0x30F3, 0x30C8}}, {0x3324, {0x30C0, 0x30FC, 0x30B9}}, {0x3325, {0x30C7, 0x30B7}},
+    {0x3326, {0x30C9, 0x30EB}}, {0x3327, {0x30C8, 0x30F3}}, {0x3328, {0x30CA, 0x30CE}},
+    {0x3329, {0x30CE, 0x30C3, 0x30C8}}, {0x332A, {0x30CF, 0x30A4, 0x30C4}}, {0x332C, {0x30D1, 0x30FC, 0x30C4}},
+    {0x332D, {0x30D0, 0x30FC, 0x30EC, 0x30EB}}, {0x332F, {0x30D4, 0x30AF, 0x30EB}}, {0x3330, {0x30D4, 0x30B3}},
+    {0x3331, {0x30D3, 0x30EB}}, {0x3333, {0x30D5, 0x30A3, 0x30FC, 0x30C8}}, {0x3335, {0x30D5, 0x30E9, 0x30F3}},
+    {0x3337, {0x30DA, 0x30BD}}, {0x3338, {0x30DA, 0x30CB, 0x30D2}}, {0x3339, {0x30D8, 0x30EB, 0x30C4}},
+    {0x333A, {0x30DA, 0x30F3, 0x30B9}}, {0x333B, {0x30DA, 0x30FC, 0x30B8}}, {0x333C, {0x30D9, 0x30FC, 0x30BF}},
+    {0x333D, {0x30DD, 0x30A4, 0x30F3, 0x30C8}}, {0x333E, {0x30DC, 0x30EB, 0x30C8}}, {0x333F, {0x30DB, 0x30F3}},
+    {0x3340, {0x30DD, 0x30F3, 0x30C9}}, {0x3341, {0x30DB, 0x30FC, 0x30EB}}, {0x3342, {0x30DB, 0x30FC, 0x30F3}},
+    {0x3343, {0x30DE, 0x30A4, 0x30AF, 0x30ED}}, {0x3344, {0x30DE, 0x30A4, 0x30EB}}, {0x3345, {0x30DE, 0x30C3, 0x30CF}},
+    {0x3346, {0x30DE, 0x30EB, 0x30AF}}, {0x3348, {0x30DF, 0x30AF, 0x30ED, 0x30F3}}, {0x3349, {0x30DF, 0x30EA}},
+    {0x334B, {0x30E1, 0x30AC}}, {0x334C, {0x30E1, 0x30AC, 0x30C8, 0x30F3}}, {0x334D, {0x30E1, 0x30FC, 0x30C8, 0x30EB}},
+    {0x334E, {0x30E4, 0x30FC, 0x30C9}}, {0x334F, {0x30E4, 0x30FC, 0x30EB}}, {0x3350, {0x30E6, 0x30A2, 0x30F3}},
+    {0x3351, {0x30EA, 0x30C3, 0x30C8, 0x30EB}}, {0x3352, {0x30EA, 0x30E9}}, {0x3353, {0x30EB, 0x30D4, 0x30FC}},
+    {0x3354, {0x30EB, 0x30FC, 0x30D6, 0x30EB}}, {0x3355, {0x30EC, 0x30E0}}, {0x3357, {0x30EF, 0x30C3, 0x30C8}},
+    {0x3358, {0x0030, 0x70B9}}, {0x3359, {0x0031, 0x70B9}}, {0x335A, {0x0032, 0x70B9}},
+    {0x335B, {0x0033, 0x70B9}}, {0x335C, {0x0034, 0x70B9}}, {0x335D, {0x0035, 0x70B9}},
+    {0x335E, {0x0036, 0x70B9}}, {0x335F, {0x0037, 0x70B9}}, {0x3360, {0x0038, 0x70B9}},
+    {0x3361, {0x0039, 0x70B9}}, {0x3362, {0x0031, 0x0030, 0x70B9}}, {0x3363, {0x0031, 0x0031, 0x70B9}},
+    {0x3364, {0x0031, 0x0032, 0x70B9}}, {0x3365, {0x0031, 0x0033, 0x70B9}}, {0x3366, {0x0031, 0x0034, 0x70B9}},
+    {0x3367, {0x0031, 0x0035, 0x70B9}}, {0x3368, {0x0031, 0x0036, 0x70B9}}, {0x3369, {0x0031, 0x0037, 0x70B9}},
+    {0x336A, {0x0031, 0x0038, 0x70B9}}, {0x336B, {0x0031, 0x0039, 0x70B9}}, {0x336C, {0x0032, 0x0030, 0x70B9}},
+    {0x336D, {0x0032, 0x0031, 0x70B9}}, {0x336E, {0x0032, 0x0032, 0x70B9}}, {0x336F, {0x0032, 0x0033, 0x70B9}},
+    {0x3370, {0x0032, 0x0034, 0x70B9}}, {0x3371, {0x0068, 0x0050, 0x0061}}, {0x3372, {0x0064, 0x0061}},
+    {0x3373, {0x0041, 0x0055}}, {0x3374, {0x0062, 0x0061, 0x0072}}, {0x3375, {0x006F, 0x0056}},
+    {0x3376, {0x0070, 0x0063}}, {0x3377, {0x0064, 0x006D}}, {0x3378, {0x0064, 0x006D, 0x00B2}},
+    {0x3379, {0x0064, 0x006D, 0x00B3}}, {0x337A, {0x0049, 0x0055}}, {0x337B, {0x5E73, 0x6210}},
+    {0x337C, {0x662D, 0x548C}}, {0x337D, {0x5927, 0x6B63}}, {0x337E, {0x660E, 0x6CBB}},
+    {0x337F, {0x682A, 0x5F0F, 0x4F1A, 0x793E}}, {0x3380, {0x0070, 0x0041}}, {0x3381, {0x006E, 0x0041}},
+    {0x3382, {0x03BC, 0x0041}}, {0x3383, {0x006D, 0x0041}}, {0x3384, {0x006B, 0x0041}},
+    {0x3385, {0x004B, 0x0042}}, {0x3386, {0x004D, 0x0042}}, {0x3387, {0x0047, 0x0042}},
+    {0x3388, {0x0063, 0x0061, 0x006C}}, {0x3389, {0x006B, 0x0063, 0x0061, 0x006C}}, {0x338A, {0x0070, 0x0046}},
+    {0x338B, {0x006E, 0x0046}}, {0x338C, {0x03BC, 0x0046}}, {0x338D, {0x03BC, 0x0067}},
+    {0x338E, {0x006D, 0x0067}}, {0x338F, {0x006B, 0x0067}}, {0x3390, {0x0048, 0x007A}},
+    {0x3391, {0x006B, 0x0048, 0x007A}}, {0x3392, {0x004D, 0x0048, 0x007A}}, {0x3393, {0x0047, 0x0048, 0x007A}},
+    {0x3394, {0x0054, 0x0048, 0x007A}}, {0x3395, {0x03BC, 0x2113}}, {0x3396, {0x006D, 0x2113}},
+    {0x3397, {0x0064, 0x2113}}, {0x3398, {0x006B, 0x2113}}, {0x3399, {0x0066, 0x006D}},
+    {0x339A, {0x006E, 0x006D}}, {0x339B, {0x03BC, 0x006D}}, {0x339C, {0x006D, 0x006D}},
+    {0x339D, {0x0063, 0x006D}}, {0x339E, {0x006B, 0x006D}}, {0x339F, {0x006D, 0x006D, 0x00B2}},
+    {0x33A0, {0x0063, 0x006D, 0x00B2}}, {0x33A1, {0x006D, 0x00B2}}, {0x33A2, {0x006B, 0x006D, 0x00B2}},
+    {0x33A3, {0x006D, 0x006D, 0x00B3}}, {0x33A4, {0x0063, 0x006D, 0x00B3}}, {0x33A5, {0x006D, 0x00B3}},
+    {0x33A6, {0x006B, 0x006D, 0x00B3}}, {0x33A7, {0x006D, 0x2215, 0x0073}}, {0x33A8, {0x006D, 0x2215, 0x0073, 0x00B2}},
+    {0x33A9, {0x0050, 0x0061}}, {0x33AA, {0x006B, 0x0050, 0x0061}}, {0x33AB, {0x004D, 0x0050, 0x0061}},
+    {0x33AC, {0x0047, 0x0050, 0x0061}}, {0x33AD, {0x0072, 0x0061, 0x0064}}, {0x33B0, {0x0070, 0x0073}},
+    {0x33B1, {0x006E, 0x0073}}, {0x33B2, {0x03BC, 0x0073}}, {0x33B3, {0x006D, 0x0073}},
+    {0x33B4, {0x0070, 0x0056}}, {0x33B5, {0x006E, 0x0056}}, {0x33B6, {0x03BC, 0x0056}},
+    {0x33B7, {0x006D, 0x0056}}, {0x33B8, {0x006B, 0x0056}}, {0x33B9, {0x004D, 0x0056}},
+    {0x33BA, {0x0070, 0x0057}}, {0x33BB, {0x006E, 0x0057}}, {0x33BC, {0x03BC, 0x0057}},
+    {0x33BD, {0x006D, 0x0057}}, {0x33BE, {0x006B, 0x0057}}, {0x33BF, {0x004D, 0x0057}},
+    {0x33C0, {0x006B, 0x03A9}}, {0x33C1, {0x004D, 0x03A9}}, {0x33C2, {0x0061, 0x002E, 0x006D, 0x002E}},
+    {0x33C3, {0x0042, 0x0071}}, {0x33C4, {0x0063, 0x0063}}, {0x33C5, {0x0063, 0x0064}},
+    {0x33C6, {0x0043, 0x2215, 0x006B, 0x0067}}, {0x33C7, {0x0043, 0x006F, 0x002E}}, {0x33C8, {0x0064, 0x0042}},
+    {0x33C9, {0x0047, 0x0079}}, {0x33CA, {0x0068, 0x0061}}, {0x33CB, {0x0048, 0x0050}},
+    {0x33CC, {0x0069, 0x006E}}, {0x33CD, {0x004B, 0x004B}}, {0x33CE, {0x004B, 0x004D}},
+    {0x33CF, {0x006B, 0x0074}}, {0x33D0, {0x006C, 0x006D}}, {0x33D1, {0x006C, 0x006E}},
+    {0x33D2, {0x006C, 0x006F, 0x0067}}, {0x33D3, {0x006C, 0x0078}}, {0x33D4, {0x006D, 0x0062}},
+    {0x33D5, {0x006D, 0x0069, 0x006C}}, {0x33D6, {0x006D, 0x006F, 0x006C}}, {0x33D7, {0x0050, 0x0048}},
+    {0x33D8, {0x0070, 0x002E, 0x006D, 0x002E}}, {0x33D9, {0x0050, 0x0050, 0x004D}}, {0x33DA, {0x0050, 0x0052}},
+    {0x33DB, {0x0073, 0x0072}}, {0x33DC, {0x0053, 0x0076}}, {0x33DD, {0x0057, 0x0062}},
+    {0x33DE, {0x0056, 0x2215, 0x006D}}, {0x33DF, {0x0041, 0x2215, 0x006D}}, {0x33E0, {0x0031, 0x65E5}},
+    {0x33E1, {0x0032, 0x65E5}}, {0x33E2, {0x0033, 0x65E5}}, {0x33E3, {0x0034, 0x65E5}},
+    {0x33E4, {0x0035, 0x65E5}}, {0x33E5, {0x0036, 0x65E5}}, {0x33E6, {0x0037, 0x65E5}},
+    {0x33E7, {0x0038, 0x65E5}}, {0x33E8, {0x0039, 0x65E5}}, {0x33E9, {0x0031, 0x0030, 0x65E5}},
+    {0x33EA, {0x0031, 0x0031, 0x65E5}}, {0x33EB, {0x0031, 0x0032, 0x65E5}}, {0x33EC, {0x0031, 0x0033, 0x65E5}},
+    {0x33ED, {0x0031, 0x0034, 0x65E5}}, {0x33EE, {0x0031, 0x0035, 0x65E5}}, {0x33EF, {0x0031, 0x0036, 0x65E5}},
+    {0x33F0, {0x0031, 0x0037, 0x65E5}}, {0x33F1, {0x0031, 0x0038, 0x65E5}}, {0x33F2, {0x0031, 0x0039, 0x65E5}},
+    {0x33F3, {0x0032, 0x0030, 0x65E5}}, {0x33F4, {0x0032, 0x0031, 0x65E5}}, {0x33F5, {0x0032, 0x0032, 0x65E5}},
+    {0x33F6, {0x0032, 0x0033, 0x65E5}}, {0x33F7, {0x0032, 0x0034, 0x65E5}}, {0x33F8, {0x0032, 0x0035, 0x65E5}},
+    {0x33F9, {0x0032, 0x0036, 0x65E5}}, {0x33FA, {0x0032, 0x0037, 0x65E5}}, {0x33FB, {0x0032, 0x0038, 0x65E5}},
+    {0x33FC, {0x0032, 0x0039, 0x65E5}}, {0x33FD, {0x0033, 0x0030, 0x65E5}}, {0x33FE, {0x0033, 0x0031, 0x65E5}},
+    {0x33FF, {0x0067, 0x0061, 0x006C}}, {0xFB00, {0x0066, 0x0066}}, {0xFB01, {0x0066, 0x0069}},
+    {0xFB02, {0x0066, 0x006C}}, {0xFB03, {0x0066, 0x0066, 0x0069}}, {0xFB04, {0x0066, 0x0066, 0x006C}},
+    {0xFB05, {0x017F, 0x0074}}, {0xFB06, {0x0073, 0x0074}}, {0xFB13, {0x0574, 0x0576}},
+    {0xFB14, {0x0574, 0x0565}}, {0xFB15, {0x0574, 0x056B}}, {0xFB16, {0x057E, 0x0576}},
+    {0xFB17, {0x0574, 0x056D}}, {0xFB4F, {0x05D0, 0x05DC}}, {0xFBEA, {0x0626, 0x0627}},
+    {0xFBEB, {0x0626, 0x0627}}, {0xFBEC, {0x0626, 0x06D5}}, {0xFBED, {0x0626, 0x06D5}},
+    {0xFBEE, {0x0626, 0x0648}}, {0xFBEF, {0x0626, 0x0648}}, {0xFBF0, {0x0626, 0x06C7}},
+    {0xFBF1, {0x0626, 0x06C7}}, {0xFBF2, {0x0626, 0x06C6}}, {0xFBF3, {0x0626, 0x06C6}},
+    {0xFBF4, {0x0626, 0x06C8}}, {0xFBF5, {0x0626, 0x06C8}}, {0xFBF6, {0x0626, 0x06D0}},
+    {0xFBF7, {0x0626, 0x06D0}}, {0xFBF8, {0x0626, 0x06D0}}, {0xFBF9, {0x0626, 0x0649}},
+    {0xFBFA, {0x0626, 0x0649}}, {0xFBFB, {0x0626, 0x0649}}, {0xFC00, {0x0626, 0x062C}},
+    {0xFC01, {0x0626, 0x062D}}, {0xFC02, {0x0626, 0x0645}}, {0xFC03, {0x0626, 0x0649}},
+    {0xFC04, {0x0626, 0x064A}}, {0xFC05, {0x0628, 0x062C}}, {0xFC06, {0x0628, 0x062D}},
+    {0xFC07, {0x0628, 0x062E}}, {0xFC08, {0x0628, 0x0645}}, {0xFC09, {0x0628, 0x0649}},
+    {0xFC0A, {0x0628, 0x064A}}, {0xFC0B, {0x062A, 0x062C}}, {0xFC0C, {0x062A, 0x062D}},
+    {0xFC0D, {0x062A, 0x062E}}, {0xFC0E, {0x062A, 0x0645}}, {0xFC0F, {0x062A, 0x0649}},
+    {0xFC10, {0x062A, 0x064A}}, {0xFC11, {0x062B, 0x062C}}, {0xFC12, {0x062B, 0x0645}},
+    {0xFC13, {0x062B, 0x0649}}, {0xFC14, {0x062B, 0x064A}}, {0xFC15, {0x062C, 0x062D}},
+    {0xFC16, {0x062C, 0x0645}}, {0xFC17, {0x062D, 0x062C}}, {0xFC18, {0x062D, 0x0645}},
+    {0xFC19, {0x062E, 0x062C}}, {0xFC1A, {0x062E, 0x062D}}, {0xFC1B, {0x062E, 0x0645}},
+    {0xFC1C, {0x0633, 0x062C}}, {0xFC1D, {0x0633, 0x062D}}, {0xFC1E, {0x0633, 0x062E}},
+    {0xFC1F, {0x0633, 0x0645}}, {0xFC20, {0x0635, 0x062D}}, {0xFC21, {0x0635, 0x0645}},
+    {0xFC22, {0x0636, 0x062C}}, {0xFC23, {0x0636, 0x062D}}, {0xFC24, {0x0636, 0x062E}},
+    {0xFC25, {0x0636, 0x0645}}, {0xFC26, {0x0637, 0x062D}}, {0xFC27, {0x0637, 0x0645}},
+    {0xFC28, {0x0638, 0x0645}}, {0xFC29, {0x0639, 0x062C}}, {0xFC2A, {0x0639, 0x0645}},
+    {0xFC2B, {0x063A, 0x062C}}, {0xFC2C, {0x063A, 0x0645}}, {0xFC2D, {0x0641, 0x062C}},
+    {0xFC2E, {0x0641, 0x062D}}, {0xFC2F, {0x0641, 0x062E}}, {0xFC30, {0x0641, 0x0645}},
+    {0xFC31, {0x0641, 0x0649}}, {0xFC32, {0x0641, 0x064A}}, {0xFC33, {0x0642, 0x062D}},
+    {0xFC34, {0x0642, 0x0645}}, {0xFC35, {0x0642, 0x0649}}, {0xFC36, {0x0642, 0x064A}},
+    {0xFC37, {0x0643, 0x0627}}, {0xFC38, {0x0643, 0x062C}}, {0xFC39, {0x0643, 0x062D}},
+    {0xFC3A, {0x0643, 0x062E}}, {0xFC3B, {0x0643, 0x0644}}, {0xFC3C, {0x0643, 0x0645}},
+    {0xFC3D, {0x0643, 0x0649}}, {0xFC3E, {0x0643, 0x064A}}, {0xFC3F, {0x0644, 0x062C}},
+    {0xFC40, {0x0644, 0x062D}}, {0xFC41, {0x0644, 0x062E}}, {0xFC42, {0x0644, 0x0645}},
+    {0xFC43, {0x0644, 0x0649}}, {0xFC44, {0x0644, 0x064A}}, {0xFC45, {0x0645, 0x062C}},
+    {0xFC46, {0x0645, 0x062D}}, {0xFC47, {0x0645, 0x062E}}, {0xFC48, {0x0645, 0x0645}},
+    {0xFC49, {0x0645, 0x0649}}, {0xFC4A, {0x0645, 0x064A}}, {0xFC4B, {0x0646, 0x062C}},
+    {0xFC4C, {0x0646, 0x062D}}, {0xFC4D, {0x0646, 0x062E}}, {0xFC4E, {0x0646, 0x0645}},
+    {0xFC4F, {0x0646, 0x0649}}, {0xFC50, {0x0646, 0x064A}}, {0xFC51, {0x0647, 0x062C}},
+    {0xFC52, {0x0647, 0x0645}}, {0xFC53, {0x0647, 0x0649}}, {0xFC54, {0x0647, 0x064A}},
+    {0xFC55, {0x064A, 0x062C}}, {0xFC56, {0x064A, 0x062D}}, {0xFC57, {0x064A, 0x062E}},
+    {0xFC58, {0x064A, 0x0645}}, {0xFC59, {0x064A, 0x0649}}, {0xFC5A, {0x064A, 0x064A}},
+    {0xFC5B, {0x0630, 0x0670}}, {0xFC5C, {0x0631, 0x0670}}, {0xFC5D, {0x0649, 0x0670}},
+    {0xFC5E, {0x0020, 0x064C, 0x0651}}, {0xFC5F, {0x0020, 0x064D, 0x0651}}, {0xFC60, {0x0020, 0x064E, 0x0651}},
+    {0xFC61, {0x0020, 0x064F, 0x0651}}, {0xFC62, {0x0020, 0x0650, 0x0651}}, {0xFC63, {0x0020, 0x0651, 0x0670}},
+    {0xFC64, {0x0626, 0x0631}}, {0xFC65, {0x0626, 0x0632}}, {0xFC66, {0x0626, 0x0645}},
+    {0xFC67, {0x0626, 0x0646}}, {0xFC68, {0x0626, 0x0649}}, {0xFC69, {0x0626, 0x064A}},
+    {0xFC6A, {0x0628, 0x0631}}, {0xFC6B, {0x0628, 0x0632}}, {0xFC6C, {0x0628, 0x0645}},
+    {0xFC6D, {0x0628, 0x0646}}, {0xFC6E, {0x0628, 0x0649}}, {0xFC6F, {0x0628, 0x064A}},
+    {0xFC70, {0x062A, 0x0631}}, {0xFC71, {0x062A, 0x0632}}, {0xFC72, {0x062A, 0x0645}},
+    {0xFC73, {0x062A, 0x0646}}, {0xFC74, {0x062A, 0x0649}}, {0xFC75, {0x062A, 0x064A}},
+    {0xFC76, {0x062B, 0x0631}}, {0xFC77, {0x062B, 0x0632}}, {0xFC78, {0x062B, 0x0645}},
+    {0xFC79, {0x062B, 0x0646}}, {0xFC7A, {0x062B, 0x0649}}, {0xFC7B, {0x062B, 0x064A}},
+    {0xFC7C, {0x0641, 0x0649}}, {0xFC7D, {0x0641, 0x064A}}, {0xFC7E, {0x0642, 0x0649}},
+    {0xFC7F, {0x0642, 0x064A}}, {0xFC80, {0x0643, 0x0627}}, {0xFC81, {0x0643, 0x0644}},
+    {0xFC82, {0x0643, 0x0645}}, {0xFC83, {0x0643, 0x0649}}, {0xFC84, {0x0643, 0x064A}},
+    {0xFC85, {0x0644, 0x0645}}, {0xFC86, {0x0644, 0x0649}}, {0xFC87, {0x0644, 0x064A}},
+    {0xFC88, {0x0645, 0x0627}}, {0xFC89, {0x0645, 0x0645}}, {0xFC8A, {0x0646, 0x0631}},
+    {0xFC8B, {0x0646, 0x0632}}, {0xFC8C, {0x0646, 0x0645}}, {0xFC8D, {0x0646, 0x0646}},
+    {0xFC8E, {0x0646, 0x0649}}, {0xFC8F, {0x0646, 0x064A}}, {0xFC90, {0x0649, 0x0670}},
+    {0xFC91, {0x064A, 0x0631}}, {0xFC92, {0x064A, 0x0632}}, {0xFC93, {0x064A, 0x0645}},
+    {0xFC94, {0x064A, 0x0646}}, {0xFC95, {0x064A, 0x0649}}, {0xFC96, {0x064A, 0x064A}},
+    {0xFC97, {0x0626, 0x062C}}, {0xFC98, {0x0626, 0x062D}}, {0xFC99, {0x0626, 0x062E}},
+    {0xFC9A, {0x0626, 0x0645}}, {0xFC9B, {0x0626, 0x0647}}, {0xFC9C, {0x0628, 0x062C}},
+    {0xFC9D, {0x0628, 0x062D}}, {0xFC9E, {0x0628, 0x062E}}, {0xFC9F, {0x0628, 0x0645}},
+    {0xFCA0, {0x0628, 0x0647}}, {0xFCA1, {0x062A, 0x062C}}, {0xFCA2, {0x062A, 0x062D}},
+    {0xFCA3, {0x062A, 0x062E}}, {0xFCA4, {0x062A, 0x0645}}, {0xFCA5, {0x062A, 0x0647}},
+    {0xFCA6, {0x062B, 0x0645}}, {0xFCA7, {0x062C, 0x062D}}, {0xFCA8, {0x062C, 0x0645}},
+    {0xFCA9, {0x062D, 0x062C}}, {0xFCAA, {0x062D, 0x0645}}, {0xFCAB, {0x062E, 0x062C}},
+    {0xFCAC, {0x062E, 0x0645}}, {0xFCAD, {0x0633, 0x062C}}, {0xFCAE, {0x0633, 0x062D}},
+    {0xFCAF, {0x0633, 0x062E}}, {0xFCB0, {0x0633, 0x0645}}, {0xFCB1, {0x0635, 0x062D}},
+    {0xFCB2, {0x0635, 0x062E}}, {0xFCB3, {0x0635, 0x0645}}, {0xFCB4, {0x0636, 0x062C}},
+    {0xFCB5, {0x0636, 0x062D}}, {0xFCB6, {0x0636, 0x062E}}, {0xFCB7, {0x0636, 0x0645}},
+    {0xFCB8, {0x0637, 0x062D}}, {0xFCB9, {0x0638, 0x0645}}, {0xFCBA, {0x0639, 0x062C}},
+    {0xFCBB, {0x0639, 0x0645}}, {0xFCBC, {0x063A, 0x062C}}, {0xFCBD, {0x063A, 0x0645}},
+    {0xFCBE, {0x0641, 0x062C}}, {0xFCBF, {0x0641, 0x062D}}, {0xFCC0, {0x0641, 0x062E}},
+    {0xFCC1, {0x0641, 0x0645}}, {0xFCC2, {0x0642, 0x062D}}, {0xFCC3, {0x0642, 0x0645}},
+    {0xFCC4, {0x0643, 0x062C}}, {0xFCC5, {0x0643, 0x062D}}, {0xFCC6, {0x0643, 0x062E}},
+    {0xFCC7, {0x0643, 0x0644}}, {0xFCC8, {0x0643, 0x0645}}, {0xFCC9, {0x0644, 0x062C}},
+    {0xFCCA, {0x0644, 0x062D}}, {0xFCCB, {0x0644, 0x062E}}, {0xFCCC, {0x0644, 0x0645}},
+    {0xFCCD, {0x0644, 0x0647}}, {0xFCCE, {0x0645, 0x062C}}, {0xFCCF, {0x0645, 0x062D}},
+    {0xFCD0, {0x0645, 0x062E}}, {0xFCD1, {0x0645, 0x0645}}, {0xFCD2, {0x0646, 0x062C}},
+    {0xFCD3, {0x0646, 0x062D}}, {0xFCD4, {0x0646, 0x062E}}, {0xFCD5, {0x0646, 0x0645}},
+    {0xFCD6, {0x0646, 0x0647}}, {0xFCD7, {0x0647, 0x062C}}, {0xFCD8, {0x0647, 0x0645}},
+    {0xFCD9, {0x0647, 0x0670}}, {0xFCDA, {0x064A, 0x062C}}, {0xFCDB, {0x064A, 0x062D}},
+    {0xFCDC, {0x064A, 0x062E}}, {0xFCDD, {0x064A, 0x0645}}, {0xFCDE, {0x064A, 0x0647}},
+    {0xFCDF, {0x0626, 0x0645}}, {0xFCE0, {0x0626, 0x0647}}, {0xFCE1, {0x0628, 0x0645}},
+    {0xFCE2, {0x0628, 0x0647}}, {0xFCE3, {0x062A, 0x0645}}, {0xFCE4, {0x062A, 0x0647}},
+    {0xFCE5, {0x062B, 0x0645}}, {0xFCE6, {0x062B, 0x0647}}, {0xFCE7, {0x0633, 0x0645}},
+    {0xFCE8, {0x0633, 0x0647}}, {0xFCE9, {0x0634, 0x0645}}, {0xFCEA, {0x0634, 0x0647}},
+    {0xFCEB, {0x0643, 0x0644}}, {0xFCEC, {0x0643, 0x0645}}, {0xFCED, {0x0644, 0x0645}},
+    {0xFCEE, {0x0646, 0x0645}}, {0xFCEF, {0x0646, 0x0647}}, {0xFCF0, {0x064A, 0x0645}},
+    {0xFCF1, {0x064A, 0x0647}}, {0xFCF2, {0x0640, 0x064E, 0x0651}}, {0xFCF3, {0x0640, 0x064F, 0x0651}},
+    {0xFCF4, {0x0640, 0x0650, 0x0651}}, {0xFCF5, {0x0637, 0x0649}}, {0xFCF6, {0x0637, 0x064A}},
+    {0xFCF7, {0x0639, 0x0649}}, {0xFCF8, {0x0639, 0x064A}}, {0xFCF9, {0x063A, 0x0649}},
+    {0xFCFA, {0x063A, 0x064A}}, {0xFCFB, {0x0633, 0x0649}}, {0xFCFC, {0x0633, 0x064A}},
+    {0xFCFD, {0x0634, 0x0649}}, {0xFCFE, {0x0634, 0x064A}}, {0xFCFF, {0x062D, 0x0649}},
+    {0xFD00, {0x062D, 0x064A}}, {0xFD01, {0x062C, 0x0649}}, {0xFD02, {0x062C, 0x064A}},
+    {0xFD03, {0x062E, 0x0649}}, {0xFD04, {0x062E, 0x064A}}, {0xFD05, {0x0635, 0x0649}},
+    {0xFD06, {0x0635, 0x064A}}, {0xFD07, {0x0636, 0x0649}}, {0xFD08, {0x0636, 0x064A}},
+    {0xFD09, {0x0634, 0x062C}}, {0xFD0A, {0x0634, 0x062D}}, {0xFD0B, {0x0634, 0x062E}},
+    {0xFD0C, {0x0634, 0x0645}}, {0xFD0D, {0x0634, 0x0631}}, {0xFD0E, {0x0633, 0x0631}},
+    {0xFD0F, {0x0635, 0x0631}}, {0xFD10, {0x0636, 0x0631}}, {0xFD11, {0x0637, 0x0649}},
+    {0xFD12, {0x0637, 0x064A}}, {0xFD13, {0x0639, 0x0649}}, {0xFD14, {0x0639, 0x064A}},
+    {0xFD15, {0x063A, 0x0649}}, {0xFD16, {0x063A, 0x064A}}, {0xFD17, {0x0633, 0x0649}},
+    {0xFD18, {0x0633, 0x064A}}, {0xFD19, {0x0634, 0x0649}}, {0xFD1A, {0x0634, 0x064A}},
+    {0xFD1B, {0x062D, 0x0649}}, {0xFD1C, {0x062D, 0x064A}}, {0xFD1D, {0x062C, 0x0649}},
+    {0xFD1E, {0x062C, 0x064A}}, {0xFD1F, {0x062E, 0x0649}}, {0xFD20, {0x062E, 0x064A}},
+    {0xFD21, {0x0635, 0x0649}}, {0xFD22, {0x0635, 0x064A}}, {0xFD23, {0x0636, 0x0649}},
+    {0xFD24, {0x0636, 0x064A}}, {0xFD25, {0x0634, 0x062C}}, {0xFD26, {0x0634, 0x062D}},
+    {0xFD27, {0x0634, 0x062E}}, {0xFD28, {0x0634, 0x0645}}, {0xFD29, {0x0634, 0x0631}},
+    {0xFD2A, {0x0633, 0x0631}}, {0xFD2B, {0x0635, 0x0631}}, {0xFD2C, {0x0636, 0x0631}},
+    {0xFD2D, {0x0634, 0x062C}}, {0xFD2E, {0x0634, 0x062D}}, {0xFD2F, {0x0634, 0x062E}},
+    {0xFD30, {0x0634, 0x0645}}, {0xFD31, {0x0633, 0x0647}}, {0xFD32, {0x0634, 0x0647}},
+    {0xFD33, {0x0637, 0x0645}}, {0xFD34, {0x0633, 0x062C}}, {0xFD35, {0x0633, 0x062D}},
+    {0xFD36, {0x0633, 0x062E}}, {0xFD37, {0x0634, 0x062C}}, {0xFD38, {0x0634, 0x062D}},
+    {0xFD39, {0x0634, 0x062E}}, {0xFD3A, {0x0637, 0x0645}}, {0xFD3B, {0x0638, 0x0645}},
+    {0xFD3C, {0x0627, 0x064B}}, {0xFD3D, {0x0627, 0x064B}}, {0xFD50, {0x062A, 0x062C, 0x0645}},
+    {0xFD51, {0x062A, 0x062D, 0x062C}}, {0xFD52, {0x062A, 0x062D, 0x062C}}, {0xFD53, {0x062A, 0x062D, 0x0645}},
+    {0xFD54, {0x062A, 0x062E, 0x0645}}, {0xFD55, {0x062A, 0x0645, 0x062C}}, {0xFD56, {0x062A, 0x0645, 0x062D}},
+    {0xFD57, {0x062A, 0x0645, 0x062E}}, {0xFD58, {0x062C, 0x0645, 0x062D}}, {0xFD59, {0x062C, 0x0645, 0x062D}},
+    {0xFD5A, {0x062D, 0x0645, 0x064A}}, {0xFD5B, {0x062D, 0x0645, 0x0649}}, {0xFD5C, {0x0633, 0x062D, 0x062C}},
+    {0xFD5D, {0x0633, 0x062C, 0x062D}}, {0xFD5E, {0x0633, 0x062C, 0x0649}}, {0xFD5F, {0x0633, 0x0645, 0x062D}},
+    {0xFD60, {0x0633, 0x0645, 0x062D}}, {0xFD61, {0x0633, 0x0645, 0x062C}}, {0xFD62, {0x0633, 0x0645, 0x0645}},
+    {0xFD63, {0x0633, 0x0645, 0x0645}}, {0xFD64, {0x0635, 0x062D, 0x062D}}, {0xFD65, {0x0635, 0x062D, 0x062D}},
+    {0xFD66, {0x0635, 0x0645, 0x0645}}, {0xFD67, {0x0634, 0x062D, 0x0645}}, {0xFD68, {0x0634, 0x062D, 0x0645}},
+    {0xFD69, {0x0634, 0x062C, 0x064A}}, {0xFD6A, {0x0634, 0x0645, 0x062E}}, {0xFD6B, {0x0634, 0x0645, 0x062E}},
+    {0xFD6C, {0x0634, 0x0645, 0x0645}}, {0xFD6D, {0x0634, 0x0645, 0x0645}}, {0xFD6E, {0x0636, 0x062D, 0x0649}},
+    {0xFD6F, {0x0636, 0x062E, 0x0645}}, {0xFD70, {0x0636, 0x062E, 0x0645}}, {0xFD71, {0x0637, 0x0645, 0x062D}},
+    {0xFD72, {0x0637, 0x0645, 0x062D}}, {0xFD73, {0x0637, 0x0645, 0x0645}}, {0xFD74, {0x0637, 0x0645, 0x064A}},
+    {0xFD75, {0x0639, 0x062C, 0x0645}}, {0xFD76, {0x0639, 0x0645, 0x0645}}, {0xFD77, {0x0639, 0x0645, 0x0645}},
+    {0xFD78, {0x0639, 0x0645, 0x0649}}, {0xFD79, {0x063A, 0x0645, 0x0645}}, {0xFD7A, {0x063A, 0x0645, 0x064A}},
+    {0xFD7B, {0x063A, 0x0645, 0x0649}}, {0xFD7C, {0x0641, 0x062E, 0x0645}}, {0xFD7D, {0x0641, 0x062E, 0x0645}},
+    {0xFD7E, {0x0642, 0x0645, 0x062D}}, {0xFD7F, {0x0642, 0x0645, 0x0645}}, {0xFD80, {0x0644, 0x062D, 0x0645}},
+    {0xFD81, {0x0644, 0x062D, 0x064A}}, {0xFD82, {0x0644, 0x062D, 0x0649}}, {0xFD83, {0x0644, 0x062C, 0x062C}},
+    {0xFD84, {0x0644, 0x062C, 0x062C}}, {0xFD85, {0x0644, 0x062E, 0x0645}}, {0xFD86, {0x0644, 0x062E, 0x0645}},
+    {0xFD87, {0x0644, 0x0645, 0x062D}}, {0xFD88, {0x0644, 0x0645, 0x062D}}, {0xFD89, {0x0645, 0x062D, 0x062C}},
+    {0xFD8A, {0x0645, 0x062D, 0x0645}}, {0xFD8B, {0x0645, 0x062D, 0x064A}}, {0xFD8C, {0x0645, 0x062C, 0x062D}},
+    {0xFD8D, {0x0645, 0x062C, 0x0645}}, {0xFD8E, {0x0645, 0x062E, 0x062C}}, {0xFD8F, {0x0645, 0x062E, 0x0645}},
+    {0xFD92, {0x0645, 0x062C, 0x062E}}, {0xFD93, {0x0647, 0x0645, 0x062C}}, {0xFD94, {0x0647, 0x0645, 0x0645}},
+    {0xFD95, {0x0646, 0x062D, 0x0645}}, {0xFD96, {0x0646, 0x062D, 0x0649}}, {0xFD97, {0x0646, 0x062C, 0x0645}},
+    {0xFD98, {0x0646, 0x062C, 0x0645}}, {0xFD99, {0x0646, 0x062C, 0x0649}}, {0xFD9A, {0x0646, 0x0645, 0x064A}},
+    {0xFD9B, {0x0646, 0x0645, 0x0649}}, {0xFD9C, {0x064A, 0x0645, 0x0645}}, {0xFD9D, {0x064A, 0x0645, 0x0645}},
+    {0xFD9E, {0x0628, 0x062E, 0x064A}}, {0xFD9F, {0x062A, 0x062C, 0x064A}}, {0xFDA0, {0x062A, 0x062C, 0x0649}},
+    {0xFDA1, {0x062A, 0x062E, 0x064A}}, {0xFDA2, {0x062A, 0x062E, 0x0649}}, {0xFDA3, {0x062A, 0x0645, 0x064A}},
+    {0xFDA4, {0x062A, 0x0645, 0x0649}}, {0xFDA5, {0x062C, 0x0645, 0x064A}}, {0xFDA6, {0x062C, 0x062D, 0x0649}},
+    {0xFDA7, {0x062C, 0x0645, 0x0649}}, {0xFDA8, {0x0633, 0x062E, 0x0649}}, {0xFDA9, {0x0635, 0x062D, 0x064A}},
+    {0xFDAA, {0x0634, 0x062D, 0x064A}}, {0xFDAB, {0x0636, 0x062D, 0x064A}}, {0xFDAC, {0x0644, 0x062C, 0x064A}},
+    {0xFDAD, {0x0644, 0x0645, 0x064A}}, {0xFDAE, {0x064A, 0x062D, 0x064A}}, {0xFDAF, {0x064A, 0x062C, 0x064A}},
+    {0xFDB0, {0x064A, 0x0645, 0x064A}}, {0xFDB1, {0x0645, 0x0645, 0x064A}}, {0xFDB2, {0x0642, 0x0645, 0x064A}},
+    {0xFDB3, {0x0646, 0x062D, 0x064A}}, {0xFDB4, {0x0642, 0x0645, 0x062D}}, {0xFDB5, {0x0644, 0x062D, 0x0645}},
+    {0xFDB6, {0x0639, 0x0645, 0x064A}}, {0xFDB7, {0x0643, 0x0645, 0x064A}}, {0xFDB8, {0x0646, 0x062C, 0x062D}},
+    {0xFDB9, {0x0645, 0x062E, 0x064A}}, {0xFDBA, {0x0644, 0x062C, 0x0645}}, {0xFDBB, {0x0643, 0x0645, 0x0645}},
+    {0xFDBC, {0x0644, 0x062C, 0x0645}}, {0xFDBD, {0x0646, 0x062C, 0x062D}}, {0xFDBE, {0x062C, 0x062D, 0x064A}},
+    {0xFDBF, {0x062D, 0x062C, 0x064A}}, {0xFDC0, {0x0645, 0x062C, 0x064A}}, {0xFDC1, {0x0641, 0x0645, 0x064A}},
+    {0xFDC2, {0x0628, 0x062D, 0x064A}}, {0xFDC3, {0x0643, 0x0645, 0x0645}}, {0xFDC4, {0x0639, 0x062C, 0x0645}},
+    {0xFDC5, {0x0635, 0x0645, 0x0645}}, {0xFDC6, {0x0633, 0x062E, 0x064A}}, {0xFDC7, {0x0646, 0x062C, 0x064A}},
+    {0xFDF0, {0x0635, 0x0644, 0x06D2}}, {0xFDF1, {0x0642, 0x0644, 0x06D2}}, {0xFDF2, {0x0627, 0x0644, 0x0644, 0x0647}},
+    {0xFDF3, {0x0627, 0x0643, 0x0628, 0x0631}}, {0xFDF4, {0x0645, 0x062D, 0x0645, 0x062F}}, {0xFDF5, {0x0635, 0x0644, 0x0639, 0x0645}},
+    {0xFDF6, {0x0631, 0x0633, 0x0648, 0x0644}}, {0xFDF7, {0x0639, 0x0644, 0x064A, 0x0647}}, {0xFDF8, {0x0648, 0x0633, 0x0644, 0x0645}},
+    {0xFDF9, {0x0635, 0x0644, 0x0649}}, {0xFDFC, {0x0631, 0x06CC, 0x0627, 0x0644}}, {0xFE70, {0x0020, 0x064B}},
+    {0xFE71, {0x0640, 0x064B}}, {0xFE72, {0x0020, 0x064C}}, {0xFE74, {0x0020, 0x064D}},
+    {0xFE76, {0x0020, 0x064E}}, {0xFE77, {0x0640, 0x064E}}, {0xFE78, {0x0020, 0x064F}},
+    {0xFE79, {0x0640, 0x064F}}, {0xFE7A, {0x0020, 0x0650}}, {0xFE7B, {0x0640, 0x0650}},
+    {0xFE7C, {0x0020, 0x0651}}, {0xFE7D, {0x0640, 0x0651}}, {0xFE7E, {0x0020, 0x0652}},
+    {0xFE7F, {0x0640, 0x0652}}, {0xFEF5, {0x0644, 0x0622}}, {0xFEF6, {0x0644, 0x0622}},
+    {0xFEF7, {0x0644, 0x0623}}, {0xFEF8, {0x0644, 0x0623}}, {0xFEF9, {0x0644, 0x0625}},
+    {0xFEFA, {0x0644, 0x0625}}, {0xFEFB, {0x0644, 0x0627}}, {0xFEFC, {0x0644, 0x0627}},
+    {0x1F100, {0x0030, 0x002E}}, {0x1F101, {0x0030, 0x002C}}, {0x1F102, {0x0031, 0x002C}},
+    {0x1F103, {0x0032, 0x002C}}, {0x1F104, {0x0033, 0x002C}}, {0x1F105, {0x0034, 0x002C}},
+    {0x1F106, {0x0035, 0x002C}}, {0x1F107, {0x0036, 0x002C}}, {0x1F108, {0x0037, 0x002C}},
+    {0x1F109, {0x0038, 0x002C}}, {0x1F10A, {0x0039, 0x002C}}, {0x1F110, {0x0028, 0x0041, 0x0029}},
+    {0x1F111, {0x0028, 0x0042, 0x0029}}, {0x1F112, {0x0028, 0x0043, 0x0029}}, {0x1F113, {0x0028, 0x0044, 0x0029}},
+    {0x1F114, {0x0028, 0x0045, 0x0029}}, {0x1F115, {0x0028, 0x0046, 0x0029}}, {0x1F116, {0x0028, 0x0047, 0x0029}},
+    {0x1F117, {0x0028, 0x0048, 0x0029}}, {0x1F118, {0x0028, 0x0049, 0x0029}}, {0x1F119, {0x0028, 0x004A, 0x0029}},
+    {0x1F11A, {0x0028, 0x004B, 0x0029}}, {0x1F11B, {0x0028, 0x004C, 0x0029}}, {0x1F11C, {0x0028, 0x004D, 0x0029}},
+    {0x1F11D, {0x0028, 0x004E, 0x0029}}, {0x1F11E, {0x0028, 0x004F, 0x0029}}, {0x1F11F, {0x0028, 0x0050, 0x0029}},
+    {0x1F120, {0x0028, 0x0051, 0x0029}}, {0x1F121, {0x0028, 0x0052, 0x0029}}, {0x1F122, {0x0028, 0x0053, 0x0029}},
+    {0x1F123, {0x0028, 0x0054, 0x0029}}, {0x1F124, {0x0028, 0x0055, 0x0029}}, {0x1F125, {0x0028, 0x0056, 0x0029}},
+    {0x1F126, {0x0028, 0x0057, 0x0029}}, {0x1F127, {0x0028, 0x0058, 0x0029}}, {0x1F128, {0x0028, 0x0059, 0x0029}},
+    {0x1F129, {0x0028, 0x005A, 0x0029}}, {0x1F12A, {0x3014, 0x0053, 0x3015}}, {0x1F12D, {0x0043, 0x0044}},
+    {0x1F12E, {0x0057, 0x005A}}, {0x1F14A, {0x0048, 0x0056}}, {0x1F14B, {0x004D, 0x0056}},
+    {0x1F14C, {0x0053, 0x0044}}, {0x1F14D, {0x0053, 0x0053}}, {0x1F14E, {0x0050, 0x0050, 0x0056}},
+    {0x1F14F, {0x0057, 0x0043}}, {0x1F16A, {0x004D, 0x0043}}, {0x1F16B, {0x004D, 0x0044}},
+    {0x1F16C, {0x004D, 0x0052}}, {0x1F190, {0x0044, 0x004A}}, {0x1F200, {0x307B, 0x304B}},
+    {0x1F201, {0x30B3, 0x30B3}}, {0x1F240, {0x3014, 0x672C, 0x3015}}, {0x1F241, {0x3014, 0x4E09, 0x3015}},
+    {0x1F242, {0x3014, 0x4E8C, 0x3015}}, {0x1F243, {0x3014, 0x5B89, 0x3015}}, {0x1F244, {0x3014, 0x70B9, 0x3015}},
+    {0x1F245, {0x3014, 0x6253, 0x3015}}, {0x1F246, {0x3014, 0x76D7, 0x3015}}, {0x1F247, {0x3014, 0x52DD, 0x3015}},
+    {0x1F248, {0x3014, 0x6557, 0x3015}},
+};
+static const CompatLongDecomposition kCompatLongDecompositions[] = {
+    {0x321D, {0x0028, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB, 0x0029}},
+    {0x321E, {0x0028, 0x110B, 0x1169, 0x1112, 0x116E, 0x0029}},
+    {0x327C, {0x110E, 0x1161, 0x11B7, 0x1100, 0x1169}},
+    {0x3307, {0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C9}},
+    {0x3315, {0x30AD, 0x30ED, 0x30B0, 0x30E9, 0x30E0}},
+    {0x3316, {0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB}},
+    {0x3317, {0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8}},
+    {0x3319, {0x30B0, 0x30E9, 0x30E0, 0x30C8, 0x30F3}},
+    {0x331A, {0x30AF, 0x30EB, 0x30BC, 0x30A4, 0x30ED}},
+    {0x3320, {0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0}},
+    {0x332B, {0x30D1, 0x30FC, 0x30BB, 0x30F3, 0x30C8}},
+    {0x332E, {0x30D4, 0x30A2, 0x30B9, 0x30C8, 0x30EB}},
+    {0x3332, {0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C9}},
+    {0x3334, {0x30D6, 0x30C3, 0x30B7, 0x30A7, 0x30EB}},
+    {0x3336, {0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB}},
+    {0x3347, {0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3}},
+    {0x334A, {0x30DF, 0x30EA, 0x30D0, 0x30FC, 0x30EB}},
+    {0x3356, {0x30EC, 0x30F3, 0x30C8, 0x30B2, 0x30F3}},
+    {0x33AE, {0x0072, 0x0061, 0x0064, 0x2215, 0x0073}},
+    {0x33AF, {0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x00B2}},
+    {0xFDFA, {0x0635, 0x0644, 0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644, 0x064A, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644, 0x0645}},
+    {0xFDFB, {0x062C, 0x0644, 0x0020, 0x062C, 0x0644, 0x0627, 0x0644, 0x0647}},
+};
+static const CombiningClassRange kCombiningClasses[] = {
+    {0x0300, 21, 230}, {0x0315, 1, 232}, {0x0316, 4, 220}, {0x031A, 1, 232}, {0x031B, 1, 216},
+    {0x031C, 5, 220}, {0x0321, 2, 202}, {0x0323, 4, 220}, {0x0327, 2, 202}, {0x0329, 11, 220},
+    {0x0334, 5, 1}, {0x0339, 4, 220}, {0x033D, 8, 230}, {0x0345, 1, 240}, {0x0346, 1, 230},
+    {0x0347, 3, 220}, {0x034A, 3, 230}, {0x034D, 2, 220}, {0x0350, 3, 230}, {0x0353, 4, 220},
+    {0x0357, 1, 230}, {0x0358, 1, 232}, {0x0359, 2, 220}, {0x035B, 1, 230}, {0x035C, 1, 233},
+    {0x035D, 2, 234}, {0x035F, 1, 233}, {0x0360, 2, 234}, {0x0362, 1, 233}, {0x0363, 13, 230},
+    {0x0483, 5, 230}, {0x0591, 1, 220}, {0x0592, 4, 230}, {0x0596, 1, 220}, {0x0597, 3, 230},
+    {0x059A, 1, 222}, {0x059B, 1, 220}, {0x059C, 6, 230}, {0x05A2, 6, 220}, {0x05A8, 2, 230},
+    {0x05AA, 1, 220}, {0x05AB, 2, 230}, {0x05AD, 1, 222}, {0x05AE, 1, 228}, {0x05AF, 1, 230},
+    {0x05B0, 1, 10}, {0x05B1, 1, 11}, {0x05B2, 1, 12}, {0x05B3, 1, 13}, {0x05B4, 1, 14},
+    {0x05B5, 1, 15}, {0x05B6, 1, 16}, {0x05B7, 1, 17}, {0x05B8, 1, 18}, {0x05B9, 2, 19},
+    {0x05BB, 1, 20}, {0x05BC, 1, 21}, {0x05BD, 1, 22}, {0x05BF, 1, 23}, {0x05C1, 1, 24},
+    {0x05C2, 1, 25}, {0x05C4, 1, 230}, {0x05C5, 1, 220}, {0x05C7, 1, 18}, {0x0610, 8, 230},
+    {0x0618, 1, 30}, {0x0619, 1, 31}, {0x061A, 1, 32}, {0x064B, 1, 27}, {0x064C, 1, 28},
+    {0x064D, 1, 29}, {0x064E, 1, 30}, {0x064F, 1, 31}, {0x0650, 1, 32}, {0x0651, 1, 33},
+    {0x0652, 1, 34}, {0x0653, 2, 230}, {0x0655, 2, 220}, {0x0657, 5, 230}, {0x065C, 1, 220},
+    {0x065D, 2, 230}, {0x065F, 1, 220}, {0x0670, 1, 35}, {0x06D6, 7, 230}, {0x06DF, 4, 230},
+    {0x06E3, 1, 220}, {0x06E4, 1, 230}, {0x06E7, 2, 230}, {0x06EA, 1, 220}, {0x06EB, 2, 230},
+    {0x06ED, 1, 220}, {0x0711, 1, 36}, {0x0730, 1, 230}, {0x0731, 1, 220}, {0x0732, 2, 230},
+    {0x0734, 1, 220}, {0x0735, 2, 230}, {0x0737, 3, 220}, {0x073A, 1, 230}, {0x073B, 2, 220},
+    {0x073D, 1, 230}, {0x073E, 1, 220}, {0x073F, 3, 230}, {0x0742, 1, 220}, {0x0743, 1, 230},
+    {0x0744, 1, 220}, {0x0745, 1, 230}, {0x0746, 1, 220}, {0x0747, 1, 230}, {0x0748, 1, 220},
+    {0x0749, 2, 230}, {0x07EB, 7, 230}, {0x07F2, 1, 220}, {0x07F3, 1, 230}, {0x07FD, 1, 220},
+    {0x0816, 4, 230}, {0x081B, 9, 230}, {0x0825, 3, 230}, {0x0829, 5, 230}, {0x0859, 3, 220},
+    {0x0898, 1, 230}, {0x0899, 3, 220}, {0x089C, 4, 230}, {0x08CA, 5, 230}, {0x08CF, 5, 220},
+    {0x08D4, 14, 230}, {0x08E3, 1, 220}, {0x08E4, 2, 230}, {0x08E6, 1, 220}, {0x08E7, 2, 230},
+    {0x08E9, 1, 220}, {0x08EA, 3, 230}, {0x08ED, 3, 220}, {0x08F0, 1, 27}, {0x08F1, 1, 28},
+    {0x08F2, 1, 29}, {0x08F3, 3, 230}, {0x08F6, 1, 220}, {0x08F7, 2, 230}, {0x08F9, 2, 220},
+    {0x08FB, 5, 230}, {0x093C, 1, 7}, {0x094D, 1, 9}, {0x0951, 1, 230}, {0x0952, 1, 220},
+    {0x0953, 2, 230}, {0x09BC, 1, 7}, {0x09CD, 1, 9}, {0x09FE, 1, 230}, {0x0A3C, 1, 7},
+    {0x0A4D, 1, 9}, {0x0ABC, 1, 7}, {0x0ACD, 1, 9}, {0x0B3C, 1, 7}, {0x0B4D, 1, 9},
+    {0x0BCD, 1, 9}, {0x0C3C, 1, 7}, {0x0C4D, 1, 9}, {0x0C55, 1, 84}, {0x0C56, 1, 91},
+    {0x0CBC, 1, 7}, {0x0CCD, 1, 9}, {0x0D3B, 2, 9}, {0x0D4D, 1, 9}, {0x0DCA, 1, 9},
+    {0x0E38, 2, 103}, {0x0E3A, 1, 9}, {0x0E48, 4, 107}, {0x0EB8, 2, 118}, {0x0EBA, 1, 9},
+    {0x0EC8, 4, 122}, {0x0F18, 2, 220}, {0x0F35, 1, 220}, {0x0F37, 1, 220}, {0x0F39, 1, 216},
+    {0x0F71, 1, 129}, {0x0F72, 1, 130}, {0x0F74, 1, 132}, {0x0F7A, 4, 130}, {0x0F80, 1, 130},
+    {0x0F82, 2, 230}, {0x0F84, 1, 9}, {0x0F86, 2, 230}, {0x0FC6, 1, 220}, {0x1037, 1, 7},
+    {0x1039, 2, 9}, {0x108D, 1, 220}, {0x135D, 3, 230}, {0x1714, 2, 9}, {0x1734, 1, 9},
+    {0x17D2, 1, 9}, {0x17DD, 1, 230}, {0x18A9, 1, 228}, {0x1939, 1, 222}, {0x193A, 1, 230},
+    {0x193B, 1, 220}, {0x1A17, 1, 230}, {0x1A18, 1, 220}, {0x1A60, 1, 9}, {0x1A75, 8, 230},
+    {0x1A7F, 1, 220}, {0x1AB0, 5, 230}, {0x1AB5, 6, 220}, {0x1ABB, 2, 230}, {0x1ABD, 1, 220},
+    {0x1ABF, 2, 220}, {0x1AC1, 2, 230}, {0x1AC3, 2, 220}, {0x1AC5, 5, 230}, {0x1ACA, 1, 220},
+    {0x1ACB, 4, 230}, {0x1B34, 1, 7}, {0x1B44, 1, 9}, {0x1B6B, 1, 230}, {0x1B6C, 1, 220},
+    {0x1B6D, 7, 230}, {0x1BAA, 2, 9}, {0x1BE6, 1, 7}, {0x1BF2, 2, 9}, {0x1C37, 1, 7},
+    {0x1CD0, 3, 230}, {0x1CD4, 1, 1}, {0x1CD5, 5, 220}, {0x1CDA, 2, 230}, {0x1CDC, 4, 220},
+    {0x1CE0, 1, 230}, {0x1CE2, 7, 1}, {0x1CED, 1, 220}, {0x1CF4, 1, 230}, {0x1CF8, 2, 230},
+    {0x1DC0, 2, 230}, {0x1DC2, 1, 220}, {0x1DC3, 7, 230}, {0x1DCA, 1, 220}, {0x1DCB, 2, 230},
+    {0x1DCD, 1, 234}, {0x1DCE, 1, 214}, {0x1DCF, 1, 220}, {0x1DD0, 1, 202}, {0x1DD1, 37, 230},
+    {0x1DF6, 1, 232}, {0x1DF7, 2, 228}, {0x1DF9, 1, 220}, {0x1DFA, 1, 218}, {0x1DFB, 1, 230},
+    {0x1DFC, 1, 233}, {0x1DFD, 1, 220}, {0x1DFE, 1, 230}, {0x1DFF, 1, 220}, {0x20D0, 2, 230},
+    {0x20D2, 2, 1}, {0x20D4, 4, 230}, {0x20D8, 3, 1}, {0x20DB, 2, 230}, {0x20E1, 1, 230},
+    {0x20E5, 2, 1}, {0x20E7, 1, 230}, {0x20E8, 1, 220}, {0x20E9, 1, 230}, {0x20EA, 2, 1},
+    {0x20EC, 4, 220}, {0x20F0, 1, 230}, {0x2CEF, 3, 230}, {0x2D7F, 1, 9}, {0x2DE0, 32, 230},
+    {0x302A, 1, 218}, {0x302B, 1, 228}, {0x302C, 1, 232}, {0x302D, 1, 222}, {0x302E, 2, 224},
+    {0x3099, 2, 8}, {0xA66F, 1, 230}, {0xA674, 10, 230}, {0xA69E, 2, 230}, {0xA6F0, 2, 230},
+    {0xA806, 1, 9}, {0xA82C, 1, 9}, {0xA8C4, 1, 9}, {0xA8E0, 18, 230}, {0xA92B, 3, 220},
+    {0xA953, 1, 9}, {0xA9B3, 1, 7}, {0xA9C0, 1, 9}, {0xAAB0, 1, 230}, {0xAAB2, 2, 230},
+    {0xAAB4, 1, 220}, {0xAAB7, 2, 230}, {0xAABE, 2, 230}, {0xAAC1, 1, 230}, {0xAAF6, 1, 9},
+    {0xABED, 1, 9}, {0xFB1E, 1, 26}, {0xFE20, 7, 230}, {0xFE27, 7, 220}, {0xFE2E, 2, 230},
+    {0x101FD, 1, 220}, {0x102E0, 1, 220}, {0x10376, 5, 230}, {0x10A0D, 1, 220}, {0x10A0F, 1, 230},
+    {0x10A38, 1, 230}, {0x10A39, 1, 1}, {0x10A3A, 1, 220}, {0x10A3F, 1, 9}, {0x10AE5, 1, 230},
+    {0x10AE6, 1, 220}, {0x10D24, 4, 230}, {0x10EAB, 2, 230}, {0x10F46, 2, 220}, {0x10F48, 3, 230},
+    {0x10F4B, 1, 220}, {0x10F4C, 1, 230}, {0x10F4D, 4, 220}, {0x10F82, 1, 230}, {0x10F83, 1, 220},
+    {0x10F84, 1, 230}, {0x10F85, 1, 220}, {0x11046, 1, 9}, {0x11070, 1, 9}, {0x1107F, 1, 9},
+    {0x110B9, 1, 9}, {0x110BA, 1, 7}, {0x11100, 3, 230}, {0x11133, 2, 9}, {0x11173, 1, 7},
+    {0x111C0, 1, 9}, {0x111CA, 1, 7}, {0x11235, 1, 9}, {0x11236, 1, 7}, {0x112E9, 1, 7},
+    {0x112EA, 1, 9}, {0x1133B, 2, 7}, {0x1134D, 1, 9}, {0x11366, 7, 230}, {0x11370, 5, 230},
+    {0x11442, 1, 9}, {0x11446, 1, 7}, {0x1145E, 1, 230}, {0x114C2, 1, 9}, {0x114C3, 1, 7},
+    {0x115BF, 1, 9}, {0x115C0, 1, 7}, {0x1163F, 1, 9}, {0x116B6, 1, 9}, {0x116B7, 1, 7},
+    {0x1172B, 1, 9}, {0x11839, 1, 9}, {0x1183A, 1, 7}, {0x1193D, 2, 9}, {0x11943, 1, 7},
+    {0x119E0, 1, 9}, {0x11A34, 1, 9}, {0x11A47, 1, 9}, {0x11A99, 1, 9}, {0x11C3F, 1, 9},
+    {0x11D42, 1, 7}, {0x11D44, 2, 9}, {0x11D97, 1, 9}, {0x16AF0, 5, 1}, {0x16B30, 7, 230},
+    {0x16FF0, 2, 6}, {0x1BC9E, 1, 1}, {0x1D165, 2, 216}, {0x1D167, 3, 1}, {0x1D16D, 1, 226},
+    {0x1D16E, 5, 216}, {0x1D17B, 8, 220}, {0x1D185, 5, 230}, {0x1D18A, 2, 220}, {0x1D1AA, 4, 230},
+    {0x1D242, 3, 230}, {0x1E000, 7, 230}, {0x1E008, 17, 230}, {0x1E01B, 7, 230}, {0x1E023, 2, 230},
+    {0x1E026, 5, 230}, {0x1E130, 7, 230}, {0x1E2AE, 1, 230}, {0x1E2EC, 4, 230}, {0x1E8D0, 7, 220},
+    {0x1E944, 6, 230}, {0x1E94A, 1, 7},
+};
+class UnicodeNormalizer {
+public:
+    static uint8_t combining_class(char32_t cp) { return uint8_t(data().props[cp] & 0xFF); }
+
+    // Повний розклад однієї кодової точки (канонічний або сумісний), без упорядкування
+    static void decompose(char32_t cp, bool compat, String<char32_t>& out) { data().decompose(cp, compat, out); }
+
+    // Швидка перевірка (UAX #15); stop — байтова позиція першої кодової точки з відповіддю не Yes
+    static QuickCheckResult quick_check(const char* p, size_t n, NormalizationForm form, size_t& stop) {
+        const Data& d = data();
+        const unsigned char threshold = form == NormalizationForm::NFC ? 0xCC : form == NormalizationForm::NFD ? 0xC3 : 0xC2;
+        const uint32_t noMask = (form == NormalizationForm::NFC ? kNfcNo : form == NormalizationForm::NFD ? kNfdNo
+                                 : form == NormalizationForm::NFKC ? kNfkcNo : kNfkdNo) << 8;
+        const uint32_t maybeMask = (form == NormalizationForm::NFC || form == NormalizationForm::NFKC) ? kComposeMaybe << 8 : 0;
+        QuickCheckResult result = QuickCheckResult::Yes;
+        stop = n;
+        uint8_t lastClass = 0;
+        size_t i = 0;
+        while (i < n) {
+#ifdef STRING_HAS_SSE2
+            // Блок без байтів >= threshold містить лише кодові точки, які завжди Yes
+            if (i + 16 <= n && static_cast<unsigned char>(p[i]) < threshold) {
+                const __m128i thr = _mm_set1_epi8(char(threshold));
+                size_t j = i;
+                while (j + 16 <= n) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + j));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, thr), v))) break;
+                    j += 16;
+                }
+                if (j != i) {
+                    while (j > i && static_cast<unsigned char>(p[j - 1]) >= 0x80) --j;
+                    if (j > i) {
+                        i = j;
+                        lastClass = 0;
+                        continue;
+                    }
+                }
+            }
+#endif
+            if (static_cast<unsigned char>(p[i]) < threshold) {
+                ++i;
+                lastClass = 0;
+                continue;
+            }
+            char32_t cp;
+            size_t len = utf8_decode(p + i, n - i, cp);
+            uint32_t pr = d.props[cp];
+            uint8_t cc = uint8_t(pr & 0xFF);
+            if ((lastClass > cc && cc != 0) || (pr & noMask)) {
+                if (result == QuickCheckResult::Yes) stop = i;
+                return QuickCheckResult::No;
+            }
+            if (pr & maybeMask && result == QuickCheckResult::Yes) {
+                result = QuickCheckResult::Maybe;
+                stop = i;
+            }
+            lastClass = cc;
+            i += len;
+        }
+        return result;
+    }
+
+    // Нормалізація всього фрагмента p[0, n)
+    static String<char> normalize(const char* p, size_t n, NormalizationForm form) {
+        const Data& d = data();
+        bool compat = form == NormalizationForm::NFKC || form == NormalizationForm::NFKD;
+        String<char32_t> buf;
+        buf.reserve(n + n / 2);
+        for (size_t i = 0; i < n;) {
+            char32_t cp;
+            size_t len = utf8_decode(p + i, n - i, cp);
+            if (cp == kInvalidCodePoint) cp = kRawByte | static_cast<unsigned char>(p[i]);
+            d.decompose(cp, compat, buf);
+            i += len;
+        }
+        d.reorder(buf);
+        if (form == NormalizationForm::NFC || form == NormalizationForm::NFKC) d.compose(buf);
+        String<char> out;
+        out.reserve(n);
+        char tmp[4];
+        for (char32_t cp : buf) {
+            if (cp & kRawByte) out += char(cp & 0xFF);
+            else out.append(tmp, utf8_encode(cp, tmp));
+        }
+        return out;
+    }
+
+    // Початок останнього стартера перед позицією stop, з якого нормалізація не зачіпає префікс
+    static size_t safe_boundary(const char* p, size_t stop, NormalizationForm form) {
+        const Data& d = data();
+        const uint32_t unsafe = (kComposeMaybe | (form == NormalizationForm::NFC ? kNfcNo : form == NormalizationForm::NFD ? kNfdNo
+                                 : form == NormalizationForm::NFKC ? kNfkcNo : kNfkdNo)) << 8;
+        size_t i = stop;
+        while (i > 0) {
+            --i;
+            while (i > 0 && (static_cast<unsigned char>(p[i]) & 0xC0) == 0x80) --i;
+            char32_t cp;
+            utf8_decode(p + i, stop - i, cp);
+            uint32_t pr = d.props[cp];
+            if ((pr & 0xFF) == 0 && !(pr & unsafe)) return i;
+        }
+        return 0;
+    }
+
+private:
+    // Прапорці у бітах 8..15 властивостей
+    static constexpr uint32_t kNfdNo = 1;
+    static constexpr uint32_t kNfkdNo = 2;
+    static constexpr uint32_t kNfcNo = 4;
+    static constexpr uint32_t kNfkcNo = 8;
+    static constexpr uint32_t kComposeMaybe = 16;
+    // Некоректні байти UTF-8 проходять нормалізацію як стартери без розкладу
+    static constexpr char32_t kRawByte = 0x80000000;
+
+    static constexpr char32_t kSBase = 0xAC00, kLBase = 0x1100, kVBase = 0x1161, kTBase = 0x11A7;
+    static constexpr char32_t kLCount = 19, kVCount = 21, kTCount = 28, kNCount = 588, kSCount = 11172;
+
+    struct Entry {
+        uint32_t offset;
+        uint8_t size;
+        bool compat;
+    };
+
+    struct Data {
+        // Біти 0..7 — клас комбінування, 8..15 — прапорці, 16..31 — номер розкладу + 1
+        CodePointTable<uint32_t> props;
+        std::vector<char32_t> pool;
+        std::vector<Entry> entries;
+        std::map<uint64_t, char32_t> compositions;
+
+        uint8_t ccc(char32_t cp) const { return uint8_t(props[cp] & 0xFF); }
+
+        void decompose(char32_t cp, bool compat, String<char32_t>& out) const {
+            if (cp >= kSBase && cp < kSBase + kSCount) {
+                char32_t s = cp - kSBase;
+                out += char32_t(kLBase + s / kNCount);
+                out += char32_t(kVBase + (s % kNCount) / kTCount);
+                if (s % kTCount) out += char32_t(kTBase + s % kTCount);
+                return;
+            }
+            uint32_t idx = props[cp] >> 16;
+            if (idx) {
+                const Entry& e = entries[idx - 1];
+                if (!e.compat || compat) {
+                    for (size_t k = 0; k < e.size; ++k) decompose(pool[e.offset + k], compat, out);
+                    return;
+                }
+            }
+            out += cp;
+        }
+
+        // Канонічне впорядкування: стабільне сортування вставками серед нестартерів
+        void reorder(String<char32_t>& b) const {
+            char32_t* p = b.begin();
+            for (size_t i = 1; i < b.size(); ++i) {
+                uint8_t cc = ccc(p[i]);
+                if (cc == 0) continue;
+                for (size_t j = i; j > 0 && ccc(p[j - 1]) > cc; --j) std::swap(p[j - 1], p[j]);
+            }
+        }
+
+        char32_t composite(char32_t a, char32_t b) const {
+            if (a >= kLBase && a < kLBase + kLCount && b >= kVBase && b < kVBase + kVCount)
+                return kSBase + ((a - kLBase) * kVCount + (b - kVBase)) * kTCount;
+            if (a >= kSBase && a < kSBase + kSCount && (a - kSBase) % kTCount == 0 && b > kTBase && b < kTBase + kTCount)
+                return a + (b - kTBase);
+            auto it = compositions.find((uint64_t(a) << 32) | b);
+            return it == compositions.end() ? 0 : it->second;
+        }
+
+        void compose(String<char32_t>& b) const {
+            if (b.empty()) return;
+            char32_t* p = b.begin();
+            size_t starterPos = 0;
+            int lastClass = ccc(p[0]) ? 256 : 0;
+            size_t out = 1;
+            for (size_t i = 1; i < b.size(); ++i) {
+                char32_t ch = p[i];
+                int cc = ccc(ch);
+                char32_t c = (lastClass < cc || lastClass == 0) ? composite(p[starterPos], ch) : 0;
+                if (c) {
+                    p[starterPos] = c;
+                    continue;
+                }
+                if (cc == 0) starterPos = out;
+                lastClass = cc;
+                p[out++] = ch;
+            }
+            b.resize(out);
+        }
+
+        void add(char32_t cp, const char32_t* to, size_t size, bool compat) {
+            entries.push_back({uint32_t(pool.size()), uint8_t(size), compat});
+            pool.insert(pool.end(), to, to + size);
+            props.set(cp, (props.get_pending(cp) & 0xFFFF) | uint32_t(entries.size()) << 16);
+        }
+
+        void flag(char32_t cp, uint32_t flags) { props.set(cp, props.get_pending(cp) | flags << 8); }
+    };
+
+    static Data build() {
+        Data d;
+        for (const CombiningClassRange& r : kCombiningClasses)
+            for (size_t i = 0; i < r.count; ++i) d.props.set(r.first + char32_t(i), r.ccc);
+        for (const CanonicalDecomposition& c : kCanonicalDecompositions) {
+            char32_t to[2] = {c.first, c.second};
+            d.add(c.cp, to, c.second ? 2 : 1, false);
+            if (c.second && std::find(std::begin(kCompositionExclusions), std::end(kCompositionExclusions), c.cp) == std::end(kCompositionExclusions))
+                d.compositions[(uint64_t(c.first) << 32) | c.second] = c.cp;
+        }
+        for (const CompatRange& r : kCompatRanges)
+            for (size_t i = 0; i < r.count; ++i) {
+                char32_t cp = r.first + char32_t(i);
+                char32_t to = char32_t(int32_t(cp) + r.delta);
+                d.add(cp, &to, 1, true);
+            }
+        for (const CompatDecomposition& c : kCompatDecompositions) {
+            size_t size = 0;
+            while (size < 4 && c.to[size]) ++size;
+            d.add(c.cp, c.to, size, true);
+        }
+        for (const CompatLongDecomposition& c : kCompatLongDecompositions) {
+            size_t size = 0;
+            while (size < 18 && c.to[size]) ++size;
+            d.add(c.cp, c.to, size, true);
+        }
+
+        // Відповіді швидкої перевірки виводяться з самих даних
+        for (const auto& comp : d.compositions) d.flag(char32_t(comp.first & 0xFFFFFFFF), kComposeMaybe);
+        for (char32_t v = kVBase; v < kVBase + kVCount; ++v) d.flag(v, kComposeMaybe);
+        for (char32_t t = kTBase + 1; t < kTBase + kTCount; ++t) d.flag(t, kComposeMaybe);
+        for (char32_t s = kSBase; s < kSBase + kSCount; ++s) d.flag(s, kNfdNo | kNfkdNo);
+        d.props.finish();
+        std::vector<std::pair<char32_t, uint32_t>> flags;
+        auto check = [&](char32_t cp) {
+            String<char32_t> canon, full;
+            d.decompose(cp, false, canon);
+            d.decompose(cp, true, full);
+            uint32_t f = kNfkdNo;
+            if (!(canon.size() == 1 && canon[0] == cp)) f |= kNfdNo;
+            d.reorder(canon);
+            d.compose(canon);
+            if (!(canon.size() == 1 && canon[0] == cp)) f |= kNfcNo | kNfkcNo;
+            d.reorder(full);
+            d.compose(full);
+            if (!(full.size() == 1 && full[0] == cp)) f |= kNfkcNo;
+            flags.push_back({cp, f});
+        };
+        for (const CanonicalDecomposition& c : kCanonicalDecompositions) check(c.cp);
+        for (const CompatRange& r : kCompatRanges)
+            for (size_t i = 0; i < r.count; ++i) check(r.first + char32_t(i));
+        for (const CompatDecomposition& c : kCompatDecompositions) check(c.cp);
+        for (const CompatLongDecomposition& c : kCompatLongDecompositions) check(c.cp);
+        for (const auto& f : flags) d.flag(f.first, f.second);
+        d.props.finish();
+        return d;
+    }
+
+    static const Data& data() {
+        static const Data d = build();
+        return d;
+    }
+};
+
+// Швидка перевірка форми нормалізації без копіювання
+inline QuickCheckResult normalization_quick_check(const String<char>& s, NormalizationForm form) {
+    size_t stop;
+    return UnicodeNormalizer::quick_check(s.begin(), s.size(), form, stop);
+}
+
+inline bool is_normalized(const String<char>& s, NormalizationForm form) {
+    size_t stop;
+    QuickCheckResult qc = UnicodeNormalizer::quick_check(s.begin(), s.size(), form, stop);
+    if (qc != QuickCheckResult::Maybe) return qc == QuickCheckResult::Yes;
+    size_t from = UnicodeNormalizer::safe_boundary(s.begin(), stop, form);
+    String<char> tail = UnicodeNormalizer::normalize(s.begin() + from, s.size() - from, form);
+    return tail.size() == s.size() - from && std::equal(tail.begin(), tail.end(), s.begin() + from);
+}
+
+// Нормалізація на місці: вже нормалізований рядок не змінюється, інакше перераховується
+// лише хвіст від останньої безпечної межі перед першою проблемою
+inline void normalize(String<char>& s, NormalizationForm form) {
+    size_t stop;
+    if (UnicodeNormalizer::quick_check(s.begin(), s.size(), form, stop) == QuickCheckResult::Yes) return;
+    size_t from = UnicodeNormalizer::safe_boundary(s.begin(), stop, form);
+    String<char> tail = UnicodeNormalizer::normalize(s.begin() + from, s.size() - from, form);
+    s.resize(from);
+    s.append(tail.begin(), tail.size());
+}
+
+// Перегляд нормалізованого тексту без копіювання: вже нормалізований s повертається як є,
+// інакше результат записується в scratch
+inline StringView<char> normalized_view(const String<char>& s, NormalizationForm form, String<char>& scratch) {
+    size_t stop;
+    if (UnicodeNormalizer::quick_check(s.begin(), s.size(), form, stop) == QuickCheckResult::Yes) return s.view();
+    size_t from = UnicodeNormalizer::safe_boundary(s.begin(), stop, form);
+    String<char> tail = UnicodeNormalizer::normalize(s.begin() + from, s.size() - from, form);
+    scratch.clear();
+    scratch.reserve(from + tail.size());
+    scratch.append(s.begin(), from);
+    scratch.append(tail.begin(), tail.size());
+    return scratch.view();
+}
+
+// Нормалізована копія; тимчасовий аргумент нормалізується у власному буфері
+inline String<char> normalized(const String<char>& s, NormalizationForm form) {
+    String<char> scratch;
+    StringView<char> text = normalized_view(s, form, scratch);
+    if (text.begin() == s.begin()) return String<char>(text);
+    return scratch;
+}
+
+inline String<char> normalized(String<char>&& s, NormalizationForm form) {
+    normalize(s, form);
+    return std::move(s);
+}
+
+// Межі графемних кластерів (UAX #29, розширені кластери)
+// Властивості Grapheme_Cluster_Break та Extended_Pictographic згенеровано з Unicode 14;
+// склади хангиль (LV/LVT) визначаються алгоритмічно.
+enum GraphemeBreak : uint8_t {
+    GB_Other, GB_CR, GB_LF, GB_Control, GB_Extend, GB_ZWJ, GB_RegionalIndicator,
+    GB_Prepend, GB_SpacingMark, GB_L, GB_V, GB_T, GB_LV, GB_LVT
+};
+
+struct GraphemeBreakRange {
+    char32_t first;
+    uint16_t count;
+    uint8_t value;
+};
+
+static const GraphemeBreakRange kGraphemeBreakRanges[] = {
+    {0x0000, 10, 3}, {0x000A, 1, 2}, {0x000B, 2, 3}, {0x000D, 1, 1}, {0x000E, 18, 3},
+    {0x007F, 33, 3}, {0x00A9, 1, 16}, {0x00AD, 1, 3}, {0x00AE, 1, 16}, {0x0300, 112, 4},
+    {0x0483, 7, 4}, {0x0591, 45, 4}, {0x05BF, 1, 4}, {0x05C1, 2, 4}, {0x05C4, 2, 4},
+    {0x05C7, 1, 4}, {0x0600, 6, 7}, {0x0610, 11, 4}, {0x061C, 1, 3}, {0x064B, 21, 4},
+    {0x0670, 1, 4}, {0x06D6, 7, 4}, {0x06DD, 1, 7}, {0x06DF, 6, 4}, {0x06E7, 2, 4},
+    {0x06EA, 4, 4}, {0x070F, 1, 7}, {0x0711, 1, 4}, {0x0730, 27, 4}, {0x07A6, 11, 4},
+    {0x07EB, 9, 4}, {0x07FD, 1, 4}, {0x0816, 4, 4}, {0x081B, 9, 4}, {0x0825, 3, 4},
+    {0x0829, 5, 4}, {0x0859, 3, 4}, {0x0890, 2, 7}, {0x0898, 8, 4}, {0x08CA, 24, 4},
+    {0x08E2, 1, 7}, {0x08E3, 32, 4}, {0x0903, 1, 8}, {0x093A, 1, 4}, {0x093B, 1, 8},
+    {0x093C, 1, 4}, {0x093E, 3, 8}, {0x0941, 8, 4}, {0x0949, 4, 8}, {0x094D, 1, 4},
+    {0x094E, 2, 8}, {0x0951, 7, 4}, {0x0962, 2, 4}, {0x0981, 1, 4}, {0x0982, 2, 8},
+    {0x09BC, 1, 4}, {0x09BE, 1, 4}, {0x09BF, 2, 8}, {0x09C1, 4, 4}, {0x09C7, 2, 8},
+    {0x09CB, 2, 8}, {0x09CD, 1, 4}, {0x09D7, 1, 4}, {0x09E2, 2, 4}, {0x09FE, 1, 4},
+    {0x0A01, 2, 4}, {0x0A03, 1, 8}, {0x0A3C, 1, 4}, {0x0A3E, 3, 8}, {0x0A41, 2, 4},
+    {0x0A47, 2, 4}, {0x0A4B, 3, 4}, {0x0A51, 1, 4}, {0x0A70, 2, 4}, {0x0A75, 1, 4},
+    {0x0A81, 2, 4}, {0x0A83, 1, 8}, {0x0ABC, 1, 4}, {0x0ABE, 3, 8}, {0x0AC1, 5, 4},
+    {0x0AC7, 2, 4}, {0x0AC9, 1, 8}, {0x0ACB, 2, 8}, {0x0ACD, 1, 4}, {0x0AE2, 2, 4},
+    {0x0AFA, 6, 4}, {0x0B01, 1, 4}, {0x0B02, 2, 8}, {0x0B3C, 1, 4}, {0x0B3E, 2, 4},
+    {0x0B40, 1, 8}, {0x0B41, 4, 4}, {0x0B47, 2, 8}, {0x0B4B, 2, 8}, {0x0B4D, 1, 4},
+    {0x0B55, 3, 4}, {0x0B62, 2, 4}, {0x0B82, 1, 4}, {0x0BBE, 1, 4}, {0x0BBF, 1, 8},
+    {0x0BC0, 1, 4}, {0x0BC1, 2, 8}, {0x0BC6, 3, 8}, {0x0BCA, 3, 8}, {0x0BCD, 1, 4},
+    {0x0BD7, 1, 4}, {0x0C00, 1, 4}, {0x0C01, 3, 8}, {0x0C04, 1, 4}, {0x0C3C, 1, 4},
+    {0x0C3E, 3, 4}, {0x0C41, 4, 8}, {0x0C46, 3, 4}, {0x0C4A, 4, 4}, {0x0C55, 2, 4},
+    {0x0C62, 2, 4}, {0x0C81, 1, 4}, {0x0C82, 2, 8}, {0x0CBC, 1, 4}, {0x0CBE, 1, 8},
+    {0x0CBF, 1, 4}, {0x0CC0, 2, 8}, {0x0CC2, 1, 4}, {0x0CC3, 2, 8}, {0x0CC6, 1, 4},
+    {0x0CC7, 2, 8}, {0x0CCA, 2, 8}, {0x0CCC, 2, 4}, {0x0CD5, 2, 4}, {0x0CE2, 2, 4},
+    {0x0D00, 2, 4}, {0x0D02, 2, 8}, {0x0D3B, 2, 4}, {0x0D3E, 1, 4}, {0x0D3F, 2, 8},
+    {0x0D41, 4, 4}, {0x0D46, 3, 8}, {0x0D4A, 3, 8}, {0x0D4D, 1, 4}, {0x0D4E, 1, 7},
+    {0x0D57, 1, 4}, {0x0D62, 2, 4}, {0x0D81, 1, 4}, {0x0D82, 2, 8}, {0x0DCA, 1, 4},
+    {0x0DCF, 1, 4}, {0x0DD0, 2, 8}, {0x0DD2, 3, 4}, {0x0DD6, 1, 4}, {0x0DD8, 7, 8},
+    {0x0DDF, 1, 4}, {0x0DF2, 2, 8}, {0x0E31, 1, 4}, {0x0E33, 1, 8}, {0x0E34, 7, 4},
+    {0x0E47, 8, 4}, {0x0EB1, 1, 4}, {0x0EB3, 1, 8}, {0x0EB4, 9, 4}, {0x0EC8, 6, 4},
+    {0x0F18, 2, 4}, {0x0F35, 1, 4}, {0x0F37, 1, 4}, {0x0F39, 1, 4}, {0x0F3E, 2, 8},
+    {0x0F71, 14, 4}, {0x0F7F, 1, 8}, {0x0F80, 5, 4}, {0x0F86, 2, 4}, {0x0F8D, 11, 4},
+    {0x0F99, 36, 4}, {0x0FC6, 1, 4}, {0x102D, 4, 4}, {0x1031, 1, 8}, {0x1032, 6, 4},
+    {0x1039, 2, 4}, {0x103B, 2, 8}, {0x103D, 2, 4}, {0x1056, 2, 8}, {0x1058, 2, 4},
+    {0x105E, 3, 4}, {0x1071, 4, 4}, {0x1082, 1, 4}, {0x1084, 1, 8}, {0x1085, 2, 4},
+    {0x108D, 1, 4}, {0x109D, 1, 4}, {0x1100, 96, 9}, {0x1160, 72, 10}, {0x11A8, 88, 11},
+    {0x135D, 3, 4}, {0x1712, 3, 4}, {0x1715, 1, 8}, {0x1732, 2, 4}, {0x1734, 1, 8},
+    {0x1752, 2, 4}, {0x1772, 2, 4}, {0x17B4, 2, 4}, {0x17B6, 1, 8}, {0x17B7, 7, 4},
+    {0x17BE, 8, 8}, {0x17C6, 1, 4}, {0x17C7, 2, 8}, {0x17C9, 11, 4}, {0x17DD, 1, 4},
+    {0x180B, 3, 4}, {0x180E, 1, 3}, {0x180F, 1, 4}, {0x1885, 2, 4}, {0x18A9, 1, 4},
+    {0x1920, 3, 4}, {0x1923, 4, 8}, {0x1927, 2, 4}, {0x1929, 3, 8}, {0x1930, 2, 8},
+    {0x1932, 1, 4}, {0x1933, 6, 8}, {0x1939, 3, 4}, {0x1A17, 2, 4}, {0x1A19, 2, 8},
+    {0x1A1B, 1, 4}, {0x1A55, 1, 8}, {0x1A56, 1, 4}, {0x1A57, 1, 8}, {0x1A58, 7, 4},
+    {0x1A60, 1, 4}, {0x1A62, 1, 4}, {0x1A65, 8, 4}, {0x1A6D, 6, 8}, {0x1A73, 10, 4},
+    {0x1A7F, 1, 4}, {0x1AB0, 31, 4}, {0x1B00, 4, 4}, {0x1B04, 1, 8}, {0x1B34, 7, 4},
+    {0x1B3B, 1, 8}, {0x1B3C, 1, 4}, {0x1B3D, 5, 8}, {0x1B42, 1, 4}, {0x1B43, 2, 8},
+    {0x1B6B, 9, 4}, {0x1B80, 2, 4}, {0x1B82, 1, 8}, {0x1BA1, 1, 8}, {0x1BA2, 4, 4},
+    {0x1BA6, 2, 8}, {0x1BA8, 2, 4}, {0x1BAA, 1, 8}, {0x1BAB, 3, 4}, {0x1BE6, 1, 4},
+    {0x1BE7, 1, 8}, {0x1BE8, 2, 4}, {0x1BEA, 3, 8}, {0x1BED, 1, 4}, {0x1BEE, 1, 8},
+    {0x1BEF, 3, 4}, {0x1BF2, 2, 8}, {0x1C24, 8, 8}, {0x1C2C, 8, 4}, {0x1C34, 2, 8},
+    {0x1C36, 2, 4}, {0x1CD0, 3, 4}, {0x1CD4, 13, 4}, {0x1CE1, 1, 8}, {0x1CE2, 7, 4},
+    {0x1CED, 1, 4}, {0x1CF4, 1, 4}, {0x1CF7, 1, 8}, {0x1CF8, 2, 4}, {0x1DC0, 64, 4},
+    {0x200B, 1, 3}, {0x200C, 1, 4}, {0x200D, 1, 5}, {0x200E, 2, 3}, {0x2028, 7, 3},
+    {0x203C, 1, 16}, {0x2049, 1, 16}, {0x2060, 16, 3}, {0x20D0, 33, 4}, {0x2122, 1, 16},
+    {0x2139, 1, 16}, {0x2194, 6, 16}, {0x21A9, 2, 16}, {0x231A, 2, 16}, {0x2328, 1, 16},
+    {0x2388, 1, 16}, {0x23CF, 1, 16}, {0x23E9, 11, 16}, {0x23F8, 3, 16}, {0x24C2, 1, 16},
+    {0x25AA, 2, 16}, {0x25B6, 1, 16}, {0x25C0, 1, 16}, {0x25FB, 4, 16}, {0x2600, 6, 16},
+    {0x2607, 12, 16}, {0x2614, 114, 16}, {0x2690, 118, 16}, {0x2708, 11, 16}, {0x2714, 1, 16},
+    {0x2716, 1, 16}, {0x271D, 1, 16}, {0x2721, 1, 16}, {0x2728, 1, 16}, {0x2733, 2, 16},
+    {0x2744, 1, 16}, {0x2747, 1, 16}, {0x274C, 1, 16}, {0x274E, 1, 16}, {0x2753, 3, 16},
+    {0x2757, 1, 16}, {0x2763, 5, 16}, {0x2795, 3, 16}, {0x27A1, 1, 16}, {0x27B0, 1, 16},
+    {0x27BF, 1, 16}, {0x2934, 2, 16}, {0x2B05, 3, 16}, {0x2B1B, 2, 16}, {0x2B50, 1, 16},
+    {0x2B55, 1, 16}, {0x2CEF, 3, 4}, {0x2D7F, 1, 4}, {0x2DE0, 32, 4}, {0x302A, 6, 4},
+    {0x3030, 1, 16}, {0x303D, 1, 16}, {0x3099, 2, 4}, {0x3297, 1, 16}, {0x3299, 1, 16},
+    {0xA66F, 4, 4}, {0xA674, 10, 4}, {0xA69E, 2, 4}, {0xA6F0, 2, 4}, {0xA802, 1, 4},
+    {0xA806, 1, 4}, {0xA80B, 1, 4}, {0xA823, 2, 8}, {0xA825, 2, 4}, {0xA827, 1, 8},
+    {0xA82C, 1, 4}, {0xA880, 2, 8}, {0xA8B4, 16, 8}, {0xA8C4, 2, 4}, {0xA8E0, 18, 4},
+    {0xA8FF, 1, 4}, {0xA926, 8, 4}, {0xA947, 11, 4}, {0xA952, 2, 8}, {0xA960, 29, 9},
+    {0xA980, 3, 4}, {0xA983, 1, 8}, {0xA9B3, 1, 4}, {0xA9B4, 2, 8}, {0xA9B6, 4, 4},
+    {0xA9BA, 2, 8}, {0xA9BC, 2, 4}, {0xA9BE, 3, 8}, {0xA9E5, 1, 4}, {0xAA29, 6, 4},
+    {0xAA2F, 2, 8}, {0xAA31, 2, 4}, {0xAA33, 2, 8}, {0xAA35, 2, 4}, {0xAA43, 1, 4},
+    {0xAA4C, 1, 4}, {0xAA4D, 1, 8}, {0xAA7C, 1, 4}, {0xAAB0, 1, 4}, {0xAAB2, 3, 4},
+    {0xAAB7, 2, 4}, {0xAABE, 2, 4}, {0xAAC1, 1, 4}, {0xAAEB, 1, 8}, {0xAAEC, 2, 4},
+    {0xAAEE, 2, 8}, {0xAAF5, 1, 8}, {0xAAF6, 1, 4}, {0xABE3, 2, 8}, {0xABE5, 1, 4},
+    {0xABE6, 2, 8}, {0xABE8, 1, 4}, {0xABE9, 2, 8}, {0xABEC, 1, 8}, {0xABED, 1, 4},
+    {0xD7B0, 23, 10}, {0xD7CB, 49, 11}, {0xD800, 2048, 3}, {0xFB1E, 1, 4}, {0xFE00, 16, 4},
+    {0xFE20, 16, 4}, {0xFEFF, 1, 3}, {0xFF9E, 2, 4}, {0xFFF0, 12, 3}, {0x101FD, 1, 4},
+    {0x102E0, 1, 4}, {0x10376, 5, 4}, {0x10A01, 3, 4}, {0x10A05, 2, 4}, {0x10A0C, 4, 4},
+    {0x10A38, 3, 4}, {0x10A3F, 1, 4}, {0x10AE5, 2, 4}, {0x10D24, 4, 4}, {0x10EAB, 2, 4},
+    {0x10F46, 11, 4}, {0x10F82, 4, 4}, {0x11000, 1, 8}, {0x11001, 1, 4}, {0x11002, 1, 8},
+    {0x11038, 15, 4}, {0x11070, 1, 4}, {0x11073, 2, 4}, {0x1107F, 3, 4}, {0x11082, 1, 8},
+    {0x110B0, 3, 8}, {0x110B3, 4, 4}, {0x110B7, 2, 8}, {0x110B9, 2, 4}, {0x110BD, 1, 7},
+    {0x110C2, 1, 4}, {0x110CD, 1, 7}, {0x11100, 3, 4}, {0x11127, 5, 4}, {0x1112C, 1, 8},
+    {0x1112D, 8, 4}, {0x11145, 2, 8}, {0x11173, 1, 4}, {0x11180, 2, 4}, {0x11182, 1, 8},
+    {0x111B3, 3, 8}, {0x111B6, 9, 4}, {0x111BF, 2, 8}, {0x111C2, 2, 7}, {0x111C9, 4, 4},
+    {0x111CE, 1, 8}, {0x111CF, 1, 4}, {0x1122C, 3, 8}, {0x1122F, 3, 4}, {0x11232, 2, 8},
+    {0x11234, 1, 4}, {0x11235, 1, 8}, {0x11236, 2, 4}, {0x1123E, 1, 4}, {0x112DF, 1, 4},
+    {0x112E0, 3, 8}, {0x112E3, 8, 4}, {0x11300, 2, 4}, {0x11302, 2, 8}, {0x1133B, 2, 4},
+    {0x1133E, 1, 4}, {0x1133F, 1, 8}, {0x11340, 1, 4}, {0x11341, 4, 8}, {0x11347, 2, 8},
+    {0x1134B, 3, 8}, {0x11357, 1, 4}, {0x11362, 2, 8}, {0x11366, 7, 4}, {0x11370, 5, 4},
+    {0x11435, 3, 8}, {0x11438, 8, 4}, {0x11440, 2, 8}, {0x11442, 3, 4}, {0x11445, 1, 8},
+    {0x11446, 1, 4}, {0x1145E, 1, 4}, {0x114B0, 1, 4}, {0x114B1, 2, 8}, {0x114B3, 6, 4},
+    {0x114B9, 1, 8}, {0x114BA, 1, 4}, {0x114BB, 2, 8}, {0x114BD, 1, 4}, {0x114BE, 1, 8},
+    {0x114BF, 2, 4}, {0x114C1, 1, 8}, {0x114C2, 2, 4}, {0x115AF, 1, 4}, {0x115B0, 2, 8},
+    {0x115B2, 4, 4}, {0x115B8, 4, 8}, {0x115BC, 2, 4}, {0x115BE, 1, 8}, {0x115BF, 2, 4},
+    {0x115DC, 2, 4}, {0x11630, 3, 8}, {0x11633, 8, 4}, {0x1163B, 2, 8}, {0x1163D, 1, 4},
+    {0x1163E, 1, 8}, {0x1163F, 2, 4}, {0x116AB, 1, 4}, {0x116AC, 1, 8}, {0x116AD, 1, 4},
+    {0x116AE, 2, 8}, {0x116B0, 6, 4}, {0x116B6, 1, 8}, {0x116B7, 1, 4}, {0x1171D, 3, 4},
+    {0x11722, 4, 4}, {0x11726, 1, 8}, {0x11727, 5, 4}, {0x1182C, 3, 8}, {0x1182F, 9, 4},
+    {0x11838, 1, 8}, {0x11839, 2, 4}, {0x11930, 1, 4}, {0x11931, 5, 8}, {0x11937, 2, 8},
+    {0x1193B, 2, 4}, {0x1193D, 1, 8}, {0x1193E, 1, 4}, {0x1193F, 1, 7}, {0x11940, 1, 8},
+    {0x11941, 1, 7}, {0x11942, 1, 8}, {0x11943, 1, 4}, {0x119D1, 3, 8}, {0x119D4, 4, 4},
+    {0x119DA, 2, 4}, {0x119DC, 4, 8}, {0x119E0, 1, 4}, {0x119E4, 1, 8}, {0x11A01, 10, 4},
+    {0x11A33, 6, 4}, {0x11A39, 1, 8}, {0x11A3A, 1, 7}, {0x11A3B, 4, 4}, {0x11A47, 1, 4},
+    {0x11A51, 6, 4}, {0x11A57, 2, 8}, {0x11A59, 3, 4}, {0x11A84, 6, 7}, {0x11A8A, 13, 4},
+    {0x11A97, 1, 8}, {0x11A98, 2, 4}, {0x11C2F, 1, 8}, {0x11C30, 7, 4}, {0x11C38, 6, 4},
+    {0x11C3E, 1, 8}, {0x11C3F, 1, 4}, {0x11C92, 22, 4}, {0x11CA9, 1, 8}, {0x11CAA, 7, 4},
+    {0x11CB1, 1, 8}, {0x11CB2, 2, 4}, {0x11CB4, 1, 8}, {0x11CB5, 2, 4}, {0x11D31, 6, 4},
+    {0x11D3A, 1, 4}, {0x11D3C, 2, 4}, {0x11D3F, 7, 4}, {0x11D46, 1, 7}, {0x11D47, 1, 4},
+    {0x11D8A, 5, 8}, {0x11D90, 2, 4}, {0x11D93, 2, 8}, {0x11D95, 1, 4}, {0x11D96, 1, 8},
+    {0x11D97, 1, 4}, {0x11EF3, 2, 4}, {0x11EF5, 2, 8}, {0x13430, 9, 3}, {0x16AF0, 5, 4},
+    {0x16B30, 7, 4}, {0x16F4F, 1, 4}, {0x16F51, 55, 8}, {0x16F8F, 4, 4}, {0x16FE4, 1, 4},
+    {0x16FF0, 2, 8}, {0x1BC9D, 2, 4}, {0x1BCA0, 4, 3}, {0x1CF00, 46, 4}, {0x1CF30, 23, 4},
+    {0x1D165, 1, 4}, {0x1D166, 1, 8}, {0x1D167, 3, 4}, {0x1D16D, 1, 8}, {0x1D16E, 5, 4},
+    {0x1D173, 8, 3}, {0x1D17B, 8, 4}, {0x1D185, 7, 4}, {0x1D1AA, 4, 4}, {0x1D242, 3, 4},
+    {0x1DA00, 55, 4}, {0x1DA3B, 50, 4}, {0x1DA75, 1, 4}, {0x1DA84, 1, 4}, {0x1DA9B, 5, 4},
+    {0x1DAA1, 15, 4}, {0x1E000, 7, 4}, {0x1E008, 17, 4}, {0x1E01B, 7, 4}, {0x1E023, 2, 4},
+    {0x1E026, 5, 4}, {0x1E130, 7, 4}, {0x1E2AE, 1, 4}, {0x1E2EC, 4, 4}, {0x1E8D0, 7, 4},
+    {0x1E944, 7, 4}, {0x1F000, 256, 16}, {0x1F10D, 3, 16}, {0x1F12F, 1, 16}, {0x1F16C, 6, 16},
+    {0x1F17E, 2, 16}, {0x1F18E, 1, 16}, {0x1F191, 10, 16}, {0x1F1AD, 57, 16}, {0x1F1E6, 26, 6},
+    {0x1F201, 15, 16}, {0x1F21A, 1, 16}, {0x1F22F, 1, 16}, {0x1F232, 9, 16}, {0x1F23C, 4, 16},
+    {0x1F249, 434, 16}, {0x1F3FB, 5, 4}, {0x1F400, 318, 16}, {0x1F546, 266, 16}, {0x1F680, 128, 16},
+    {0x1F774, 12, 16}, {0x1F7D5, 43, 16}, {0x1F80C, 4, 16}, {0x1F848, 8, 16}, {0x1F85A, 6, 16},
+    {0x1F888, 8, 16}, {0x1F8AE, 82, 16}, {0x1F90C, 47, 16}, {0x1F93C, 10, 16}, {0x1F947, 441, 16},
+    {0x1FC00, 1022, 16}, {0xE0000, 32, 3}, {0xE0020, 96, 4}, {0xE0080, 128, 3}, {0xE0100, 240, 4},
+    {0xE01F0, 3600, 3},
+};
+
+class GraphemeSegmenter {
+public:
+    static constexpr uint8_t kPictographic = 16;
+
+    // Біти 0..3 — GraphemeBreak, біт 4 — Extended_Pictographic
+    static uint8_t property(char32_t cp) {
+        if (cp >= 0xAC00 && cp <= 0xD7A3) return (cp - 0xAC00) % 28 == 0 ? GB_LV : GB_LVT;
+        if (cp == kInvalidCodePoint) return GB_Control;
+        return table()[cp];
+    }
+
+    // Пропуск до count кластерів від байтової позиції i (i — межа кластера); advanced — скільки пропущено
+    static size_t advance(const char* p, size_t n, size_t i, size_t count, size_t& advanced) {
+        advanced = 0;
+        while (i < n && advanced < count) {
+#ifdef STRING_HAS_SSE2
+            // 16 ASCII-байтів без CR, за якими йде ASCII або кінець, — рівно 16 кластерів
+            if (count - advanced >= 16 && i + 16 <= n && (i + 16 == n || static_cast<unsigned char>(p[i + 16]) < 0x80)) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                int bad = _mm_movemask_epi8(v) | _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+                if (!bad) {
+                    i += 16;
+                    advanced += 16;
+                    continue;
+                }
+            }
+#endif
+            i = next_boundary(p, n, i);
+            ++advanced;
+        }
+        return i;
+    }
+
+    // Кінець кластера, що починається в позиції i
+    static size_t next_boundary(const char* p, size_t n, size_t i) {
+        unsigned char c = static_cast<unsigned char>(p[i]);
+        if (c < 0x80 && c != '\r' && (i + 1 == n || static_cast<unsigned char>(p[i + 1]) < 0x80)) return i + 1;
+        char32_t cp;
+        size_t j = i + utf8_decode(p + i, n - i, cp);
+        uint8_t prev = property(cp);
+        bool pictographic = prev & kPictographic;
+        bool zwjAfterPictographic = false;
+        size_t riCount = (prev & 15) == GB_RegionalIndicator ? 1 : 0;
+        while (j < n) {
+            size_t len = utf8_decode(p + j, n - j, cp);
+            uint8_t next = property(cp);
+            if (!joins(prev & 15, next & 15, (next & kPictographic) && zwjAfterPictographic, riCount % 2 == 1)) break;
+            uint8_t b = next & 15;
+            if (next & kPictographic) {
+                pictographic = true;
+                zwjAfterPictographic = false;
+            } else if (b == GB_ZWJ && pictographic) {
+                pictographic = false;
+                zwjAfterPictographic = true;
+            } else if (b != GB_Extend) {
+                pictographic = zwjAfterPictographic = false;
+            }
+            riCount = b == GB_RegionalIndicator ? riCount + 1 : 0;
+            prev = next;
+            j += len;
+        }
+        return j;
+    }
+
+private:
+    static bool joins(uint8_t prev, uint8_t next, bool emojiZwj, bool riOdd) {
+        if (prev == GB_CR && next == GB_LF) return true;
+        if (prev == GB_CR || prev == GB_LF || prev == GB_Control) return false;
+        if (next == GB_CR || next == GB_LF || next == GB_Control) return false;
+        if (prev == GB_L && (next == GB_L || next == GB_V || next == GB_LV || next == GB_LVT)) return true;
+        if ((prev == GB_LV || prev == GB_V) && (next == GB_V || next == GB_T)) return true;
+        if ((prev == GB_LVT || prev == GB_T) && next == GB_T) return true;
+        if (next == GB_Extend || next == GB_ZWJ || next == GB_SpacingMark) return true;
+        if (prev == GB_Prepend) return true;
+        if (prev == GB_ZWJ && emojiZwj) return true;
+        return prev == GB_RegionalIndicator && next == GB_RegionalIndicator && riOdd;
+    }
+
+    static const CodePointTable<uint8_t>& table() {
+        static const CodePointTable<uint8_t> t = [] {
+            CodePointTable<uint8_t> b;
+            for (const GraphemeBreakRange& r : kGraphemeBreakRanges)
+                for (size_t i = 0; i < r.count; ++i) b.set(r.first + char32_t(i), r.value);
+            b.finish();
+            return b;
+        }();
+        return t;
+    }
+};
+
+// Вибірковий індекс меж кластерів: байтова позиція кожного step-го кластера,
+// щоб substr_graphemes на довгих текстах не сканував рядок від початку.
+// Індекс підключається до рядка: дописування продовжує його від останньої вибірки, а інші зміни
+// (редагування, присвоєння, знищення рядка) роблять індекс застарілим — byte_offset кидає виняток.
+class GraphemeIndex : public StringObserver<char> {
+public:
+    explicit GraphemeIndex(String<char>& s, size_t step = 256) : step(step ? step : 1) {
+        samples.push_back(0);
+        extend(s.begin(), s.size());
+        s.attach(*this);
+    }
+
+    size_t size() const { return total; }
+
+    // Байтова позиція початку кластера number
+    size_t byte_offset(const String<char>& s, size_t number) const {
+        if (stale || source() != &s) throw StringException("Grapheme index is out of date.");
+        if (number > total) throw OutOfRangeException(number);
+        size_t k = std::min(number / step, samples.size() - 1);
+        size_t advanced;
+        return GraphemeSegmenter::advance(s.begin(), s.size(), samples[k], number - k * step, advanced);
+    }
+
+    void on_append(const char* data, size_t length, size_t) override {
+        if (!stale) extend(data, length);
+    }
+
+    void on_modify(const char*, size_t, size_t, size_t) override { stale = true; }
+    void on_reset(const char*, size_t) noexcept override { stale = true; }
+
+private:
+    size_t step;
+    size_t total = 0;
+    bool stale = false;
+    std::vector<size_t> samples;
+
+    // Перерахунок від останньої вибірки: дописане може приєднатися до останнього кластера
+    void extend(const char* data, size_t length) {
+        size_t i = samples.back();
+        total = (samples.size() - 1) * step;
+        while (i < length) {
+            size_t advanced;
+            i = GraphemeSegmenter::advance(data, length, i, step, advanced);
+            total += advanced;
+            if (advanced == step && i < length) samples.push_back(i);
+        }
+    }
+};
+
+inline size_t grapheme_count(const String<char>& s) {
+    size_t count;
+    GraphemeSegmenter::advance(s.begin(), s.size(), 0, SIZE_MAX, count);
+    return count;
+}
+
+// Підрядок з len кластерів, починаючи з кластера start (як substr, але в видимих символах)
+inline String<char> substr_graphemes(const String<char>& s, size_t start, size_t len) {
+    size_t advanced;
+    size_t from = GraphemeSegmenter::advance(s.begin(), s.size(), 0, start, advanced);
+    if (advanced < start) throw OutOfRangeException(start);
+    size_t to = GraphemeSegmenter::advance(s.begin(), s.size(), from, len, advanced);
+    return s.substr(from, to - from);
+}
+
+inline String<char> substr_graphemes(const String<char>& s, size_t start, size_t len, const GraphemeIndex& index) {
+    size_t from = index.byte_offset(s, start);
+    size_t advanced;
+    size_t to = GraphemeSegmenter::advance(s.begin(), s.size(), from, len, advanced);
+    return s.substr(from, to - from);
+}
+
+// Розворот UTF-8 рядка без руйнування послідовностей: по кодових точках або по графемних кластерах.
+// ASCII-блоки розвертаються в SIMD-регістрах, решта копіюється одиницями на дзеркальну позицію.
+enum class ReverseUnit { CodePoints, Graphemes };
+
+inline String<char> utf8_reversed(const String<char>& s, ReverseUnit unit) {
+    const char* p = s.begin();
+    size_t n = s.size();
+    String<char> out(s);
+    char* o = out.begin();
+    size_t i = 0;
+    while (i < n) {
+#ifdef STRING_HAS_SSE2
+        if (i + 16 <= n) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            bool ascii = !_mm_movemask_epi8(v);
+            if (ascii && unit == ReverseUnit::Graphemes)
+                ascii = !_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')))
+                        && (i + 16 == n || static_cast<unsigned char>(p[i + 16]) < 0x80);
+            if (ascii) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(o + n - i - 16), reverse_block<1>(v));
+                i += 16;
+                continue;
+            }
+        }
+#endif
+        size_t end;
+        if (unit == ReverseUnit::Graphemes) {
+            end = GraphemeSegmenter::next_boundary(p, n, i);
+        } else {
+            char32_t cp;
+            end = i + utf8_decode(p + i, n - i, cp);
+        }
+        std::memcpy(o + n - end, p + i, end - i);
+        i = end;
+    }
+    return out;
+}
+
+// Кодування hex і base64 (RFC 4648, з доповненням)
+// AVX2-ядра обробляють 32 байти за крок, хвости і некоректні блоки — скалярний код.
+// Помилки декодування повертаються як позиція першого некоректного символу, без винятків.
+struct CodecResult {
+    bool ok;
+    size_t error_position;
+};
+
+inline String<char> hex_encode(const String<char>& in, bool uppercase = false) {
+    const char* digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    const unsigned char* src = reinterpret_cast<const unsigned char*>(in.begin());
+    size_t n = in.size();
+    String<char> out;
+    char* dst = out.resize_uninitialized(n * 2);
+    size_t i = 0;
+#ifdef STRING_HAS_AVX2
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)));
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+        __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, low));
+        __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        __m256i b = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 2 * i), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 2 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[2 * i] = digits[src[i] >> 4];
+        dst[2 * i + 1] = digits[src[i] & 0x0F];
+    }
+    return out;
+}
+
+inline int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+inline CodecResult hex_decode(const String<char>& in, String<char>& out) {
+    const char* src = in.begin();
+    size_t n = in.size();
+    if (n % 2) return {false, n - 1};
+    String<char> result;
+    unsigned char* dst = reinterpret_cast<unsigned char*>(result.resize_uninitialized(n / 2));
+    size_t i = 0;
+#ifdef STRING_HAS_AVX2
+    const __m256i zero = _mm256_set1_epi8('0');
+    const __m256i a = _mm256_set1_epi8('a');
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i five = _mm256_set1_epi8(5);
+    const __m256i ten = _mm256_set1_epi8(10);
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i d = _mm256_sub_epi8(v, zero);
+        __m256i l = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), a);
+        __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(d, nine), d);
+        __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(l, five), l);
+        if (_mm256_movemask_epi8(_mm256_or_si256(isDigit, isLetter)) != -1) break;
+        __m256i nib = _mm256_blendv_epi8(_mm256_add_epi8(l, ten), d, isDigit);
+        __m256i pairs = _mm256_maddubs_epi16(nib, weights);
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(pairs, pairs), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i / 2), _mm256_castsi256_si128(packed));
+    }
+#endif
+    for (; i < n; i += 2) {
+        int hi = hex_value(src[i]);
+        if (hi < 0) return {false, i};
+        int lo = hex_value(src[i + 1]);
+        if (lo < 0) return {false, i + 1};
+        dst[i / 2] = static_cast<unsigned char>(hi << 4 | lo);
+    }
+    out = std::move(result);
+    return {true, 0};
+}
+
+inline String<char> base64_encode(const String<char>& in) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    const unsigned char* src = reinterpret_cast<const unsigned char*>(in.begin());
+    size_t n = in.size();
+    String<char> out;
+    char* dst = out.resize_uninitialized((n + 2) / 3 * 4);
+    size_t i = 0, o = 0;
+#ifdef STRING_HAS_AVX2
+    // Кожна половина регістра отримує по 12 вхідних байтів і дає 16 символів
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                             1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i shiftLut = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                              'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    for (; i + 28 <= n; i += 24, o += 32) {
+        __m256i v = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 12)), 1);
+        v = _mm256_shuffle_epi8(v, shuffle);
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        __m256i idx = _mm256_or_si256(t0, t1);
+        __m256i r = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+        r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), idx), _mm256_set1_epi8(13)));
+        r = _mm256_add_epi8(_mm256_shuffle_epi8(shiftLut, r), idx);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + o), r);
+    }
+#endif
+    for (; i + 3 <= n; i += 3, o += 4) {
+        uint32_t v = uint32_t(src[i]) << 16 | uint32_t(src[i + 1]) << 8 | src[i + 2];
+        dst[o] = alphabet[v >> 18];
+        dst[o + 1] = alphabet[(v >> 12) & 63];
+        dst[o + 2] = alphabet[(v >> 6) & 63];
+        dst[o + 3] = alphabet[v & 63];
+    }
+    if (i < n) {
+        uint32_t v = uint32_t(src[i]) << 16 | (i + 1 < n ? uint32_t(src[i + 1]) << 8 : 0);
+        dst[o] = alphabet[v >> 18];
+        dst[o + 1] = alphabet[(v >> 12) & 63];
+        dst[o + 2] = i + 1 < n ? alphabet[(v >> 6) & 63] : '=';
+        dst[o + 3] = '=';
+    }
+    return out;
+}
+
+inline int base64_value(char c) {
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+inline CodecResult base64_decode(const String<char>& in, String<char>& out) {
+    const char* src = in.begin();
+    size_t n = in.size();
+    if (n % 4) return {false, n - n % 4};
+    size_t padding = 0;
+    if (n && src[n - 1] == '=') padding = src[n - 2] == '=' ? 2 : 1;
+    String<char> result;
+    size_t size = n / 4 * 3 - padding;
+    unsigned char* dst = reinterpret_cast<unsigned char*>(result.resize_uninitialized(size));
+    size_t i = 0, o = 0;
+#ifdef STRING_HAS_AVX2
+    // Перевірка й перетворення символів через таблиці за ніблами, далі стискання 32 -> 24 байти
+    const __m256i lutLo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                           0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lutHi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                           0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lutRoll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                             0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask2F = _mm256_set1_epi8(0x2F);
+    const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    for (; n >= 4 && i + 32 <= n - 4 && o + 32 <= size; i += 32, o += 24) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(v, 4), mask2F);
+        __m256i lo = _mm256_shuffle_epi8(lutLo, _mm256_and_si256(v, mask2F));
+        __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+        if (!_mm256_testz_si256(lo, hi)) break;
+        __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(_mm256_cmpeq_epi8(v, mask2F), hiNibbles));
+        v = _mm256_add_epi8(v, roll);
+        v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+        v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+        v = _mm256_shuffle_epi8(v, pack);
+        v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + o), v);
+    }
+#endif
+    for (; i < n; i += 4) {
+        int v[4];
+        bool last = i + 4 == n;
+        for (size_t k = 0; k < 4; ++k) {
+            v[k] = base64_value(src[i + k]);
+            if (v[k] < 0 && !(last && src[i + k] == '=' && k >= 4 - padding)) return {false, i + k};
+            if (v[k] < 0) v[k] = 0;
+        }
+        uint32_t bits = uint32_t(v[0]) << 18 | uint32_t(v[1]) << 12 | uint32_t(v[2]) << 6 | uint32_t(v[3]);
+        dst[o++] = static_cast<unsigned char>(bits >> 16);
+        if (o < size) dst[o++] = static_cast<unsigned char>(bits >> 8);
+        if (o < size) dst[o++] = static_cast<unsigned char>(bits);
+    }
+    out = std::move(result);
+    return {true, 0};
+}
+
+// Очищення полів: обрізання пробільних символів, стискання пробілів, видалення символів
+// Пробільні — ASCII-пропуски ' ', '\t', '\n', '\v', '\f', '\r' (для UTF-8 безпечно).
+// Для char маски класів символів рахуються в SSE2-регістрах по 16 байтів.
+template <typename T>
+bool is_ascii_space(T c) {
+    return c == T(' ') || (c >= T('\t') && c <= T('\r'));
+}
+
+#ifdef STRING_HAS_SSE2
+inline __m128i space_bytes(__m128i v) {
+    __m128i range = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1)));
+    return _mm_or_si128(range, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+}
+
+inline int space_mask(__m128i v) { return _mm_movemask_epi8(space_bytes(v)); }
+
+#ifdef STRING_HAS_SSSE3
+// Для кожної 8-бітної маски — керувальні байти pshufb, що збирають позначені байти підряд
+// (решта — 0x80, тобто нулі), і кількість позначених
+struct CompressShuffleTable {
+    uint64_t control[256];
+    uint8_t count[256];
+
+    constexpr CompressShuffleTable() : control(), count() {
+        for (unsigned m = 0; m < 256; ++m) {
+            uint64_t c = 0x8080808080808080ull;
+            unsigned k = 0;
+            for (unsigned b = 0; b < 8; ++b)
+                if (m >> b & 1) {
+                    c = (c & ~(uint64_t(0xFF) << 8 * k)) | uint64_t(b) << 8 * k;
+                    ++k;
+                }
+            control[m] = c;
+            count[m] = uint8_t(k);
+        }
+    }
+};
+
+static constexpr CompressShuffleTable kCompressShuffle{};
+#endif
+
+// Запис байтів блоку, позначених у keep, підряд у dst; повертає кількість записаних.
+// dst має вміщати 16 байтів: за записаними може лишитися сміття.
+// З SSSE3 кожна 8-байтова половина ущільнюється одним pshufb за таблицею, інакше — поелементно
+inline size_t compress_store(__m128i v, int keep, char* dst) {
+    if (keep == 0xFFFF) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+        return 16;
+    }
+#ifdef STRING_HAS_SSSE3
+    unsigned lo = unsigned(keep) & 0xFF, hi = (unsigned(keep) >> 8) & 0xFF;
+    __m128i control = _mm_set_epi64x(int64_t(kCompressShuffle.control[hi] + 0x0808080808080808ull),
+                                     int64_t(kCompressShuffle.control[lo]));
+    __m128i packed = _mm_shuffle_epi8(v, control);
+    size_t low = kCompressShuffle.count[lo];
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), packed);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + low), _mm_unpackhi_epi64(packed, packed));
+    return low + kCompressShuffle.count[hi];
+#else
+    alignas(16) char block[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(block), v);
+    size_t w = 0;
+    for (unsigned bits = unsigned(keep); bits; bits &= bits - 1) dst[w++] = block[count_trailing_zeros(bits)];
+    return w;
+#endif
+}
+#endif
+
+template <typename T>
+StringView<T> trim_left(StringView<T> s) {
+    const T* p = s.begin();
+    size_t n = s.size(), i = 0;
+#ifdef STRING_HAS_SSE2
+    if constexpr (sizeof(T) == 1) {
+        for (; i + 16 <= n; i += 16) {
+            int m = space_mask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+            if (m != 0xFFFF) return s.substr(i + count_trailing_zeros(unsigned(~m)), n);
+        }
+    }
+#endif
+    while (i < n && is_ascii_space(p[i])) ++i;
+    return s.substr(i, n);
+}
+
+template <typename T>
+StringView<T> trim_right(StringView<T> s) {
+    const T* p = s.begin();
+    size_t n = s.size();
+#ifdef STRING_HAS_SSE2
+    if constexpr (sizeof(T) == 1) {
+        for (; n >= 16; n -= 16) {
+            int m = space_mask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n - 16)));
+            if (m != 0xFFFF) return s.substr(0, n - 16 + 32 - count_leading_zeros32(unsigned(~m) & 0xFFFF));
+        }
+    }
+#endif
+    while (n > 0 && is_ascii_space(p[n - 1])) --n;
+    return s.substr(0, n);
+}
+
+template <typename T>
+StringView<T> trim(StringView<T> s) { return trim_right(trim_left(s)); }
+
+// Перегляди String<T> (результат дійсний, поки живе і не змінюється s)
+template <typename T>
+StringView<T> trim_left(const String<T>& s) { return trim_left(s.view()); }
+
+template <typename T>
+StringView<T> trim_right(const String<T>& s) { return trim_right(s.view()); }
+
+template <typename T>
+StringView<T> trim(const String<T>& s) { return trim(s.view()); }
+
+// Кожна серія пробільних символів замінюється одним пропуском за один прохід
+template <typename T>
+String<T> collapse_whitespace(StringView<T> s) {
+    const T* p = s.begin();
+    size_t n = s.size(), i = 0, w = 0;
+    String<T> out;
+    T* dst = out.resize_uninitialized(n);
+    bool prevSpace = false;
+#ifdef STRING_HAS_SSE2
+    if constexpr (sizeof(T) == 1) {
+        const __m128i space = _mm_set1_epi8(' ');
+        for (; i + 16 <= n; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i ws = space_bytes(v);
+            int m = _mm_movemask_epi8(ws);
+            if (!m) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + w), v);
+                w += 16;
+                prevSpace = false;
+                continue;
+            }
+            int drop = m & ((m << 1) | int(prevSpace));
+            prevSpace = (m >> 15) & 1;
+            v = _mm_or_si128(_mm_andnot_si128(ws, v), _mm_and_si128(ws, space));
+            w += compress_store(v, ~drop & 0xFFFF, reinterpret_cast<char*>(dst + w));
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        bool space = is_ascii_space(p[i]);
+        if (space && prevSpace) continue;
+        dst[w++] = space ? T(' ') : p[i];
+        prevSpace = space;
+    }
+    out.resize(w);
+    return out;
+}
+
+template <typename T>
+String<T> collapse_whitespace(const String<T>& s) { return collapse_whitespace(s.view()); }
+
+// Видалення всіх символів з набору chars
+template <typename T>
+String<T> strip_chars(StringView<T> s, StringView<T> chars) {
+    const T* p = s.begin();
+    size_t n = s.size(), i = 0, w = 0;
+    String<T> out;
+    T* dst = out.resize_uninitialized(n);
+#ifdef STRING_HAS_SSE2
+    if constexpr (sizeof(T) == 1) {
+        if (chars.size() <= 16) {
+            __m128i set[16];
+            for (size_t k = 0; k < chars.size(); ++k) set[k] = _mm_set1_epi8(char(chars.begin()[k]));
+            for (; i + 16 <= n; i += 16) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                __m128i hit = _mm_setzero_si128();
+                for (size_t k = 0; k < chars.size(); ++k) hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, set[k]));
+                w += compress_store(v, ~_mm_movemask_epi8(hit) & 0xFFFF, reinterpret_cast<char*>(dst + w));
+            }
+        }
+    }
+#endif
+    if constexpr (sizeof(T) == 1) {
+        bool table[256] = {};
+        for (T c : chars) table[static_cast<unsigned char>(c)] = true;
+        for (; i < n; ++i)
+            if (!table[static_cast<unsigned char>(p[i])]) dst[w++] = p[i];
+    } else {
+        for (; i < n; ++i)
+            if (std::find(chars.begin(), chars.end(), p[i]) == chars.end()) dst[w++] = p[i];
+    }
+    out.resize(w);
+    return out;
+}
+
+template <typename T>
+String<T> strip_chars(const String<T>& s, const String<T>& chars) { return strip_chars(s.view(), chars.view()); }
+
+// Потокове хешування байтів: результат не залежить від того, якими частинами подано дані
+class StringHasher {
+public:
+    explicit StringHasher(uint64_t seed = 0) : state(seed ^ kP1) {}
+
+    // Порожній фрагмент (зокрема src == nullptr) нічого не змінює
+    void update(const void* src, size_t n) {
+        if (!n) return;
+        const unsigned char* p = static_cast<const unsigned char*>(src);
+        total += n;
+        if (pending) {
+            size_t take = std::min(n, 8 - pending);
+            std::memcpy(buf + pending, p, take);
+            pending += take;
+            p += take;
+            n -= take;
+            if (pending < 8) return;
+            mix(load(buf));
+            pending = 0;
+        }
+        for (; n >= 8; p += 8, n -= 8) mix(load(p));
+        if (n) std::memcpy(buf, p, n);
+        pending = n;
+    }
+
+    uint64_t finish() const {
+        uint64_t h = state;
+        if (pending) {
+            unsigned char tail[8] = {};
+            std::memcpy(tail, buf, pending);
+            h = round(h, load(tail));
+        }
+        h ^= total;
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+private:
+    static constexpr uint64_t kP1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t kP2 = 0xC2B2AE3D27D4EB4FULL;
+
+    uint64_t state;
+    uint64_t total = 0;
+    unsigned char buf[8] = {};
+    size_t pending = 0;
+
+    static uint64_t load(const unsigned char* p) {
+        uint64_t w;
+        std::memcpy(&w, p, 8);
+        return w;
+    }
+
+    static uint64_t round(uint64_t h, uint64_t w) {
+        h ^= w * kP2;
+        h = (h << 31) | (h >> 33);
+        return h * kP1;
+    }
+
+    void mix(uint64_t w) { state = round(state, w); }
+};
+
+inline uint64_t hash_bytes(const void* p, size_t n, uint64_t seed = 0) {
+    StringHasher h(seed);
+    h.update(p, n);
+    return h.finish();
+}
+
+// Порівняння, пошук і хешування без урахування регістру
+// Ascii — згортаються лише A-Z; Unicode — повне згортання (CaseFolding C+F, "Straße" == "STRASSE").
+// Згортання виконується на льоту: ASCII-блоки по 16 байтів — у SSE2-регістрах, решта — по кодових точках.
+enum class CaseFolding { Ascii, Unicode };
+
+#ifdef STRING_HAS_SSE2
+inline __m128i fold_ascii_block(__m128i v) {
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+#endif
+
+inline char fold_ascii(char c) { return (c >= 'A' && c <= 'Z') ? char(c + 32) : c; }
+
+// Послідовність згорнутих кодових точок UTF-8 рядка; некоректні байти дають 0x80000000 | байт
+class FoldCursor {
+public:
+    FoldCursor(StringView<char> s, CaseFolding folding) : p(s.begin()), n(s.size()), folding(folding) {}
+
+    bool done() const { return head == count && i >= n; }
+    // Між кодовими точками джерела (немає недочитаного розгортання)
+    bool at_boundary() const { return head == count; }
+    size_t offset() const { return i; }
+    const char* data() const { return p; }
+    size_t size() const { return n; }
+    void skip(size_t bytes) { i += bytes; }
+
+    char32_t next() {
+        if (head < count) return folded[head++];
+        unsigned char c = static_cast<unsigned char>(p[i]);
+        if (c < 0x80) {
+            ++i;
+            return char32_t(fold_ascii(char(c)));
+        }
+        char32_t cp;
+        size_t len = utf8_decode(p + i, n - i, cp);
+        i += len;
+        if (cp == kInvalidCodePoint) return 0x80000000 | c;
+        if (folding == CaseFolding::Ascii) return cp;
+        count = UnicodeCase::map(cp, CaseMapping::Fold, folded);
+        head = 1;
+        return folded[0];
+    }
+
+private:
+    const char* p;
+    size_t n;
+    size_t i = 0;
+    CaseFolding folding;
+    char32_t folded[3] = {};
+    size_t head = 0, count = 0;
+};
+
+// Порівняння потоків згорнутих кодових точок: <0, 0 або >0
+inline int compare_ci(StringView<char> a, StringView<char> b, CaseFolding folding = CaseFolding::Unicode) {
+    FoldCursor x(a, folding), y(b, folding);
+    while (true) {
+#ifdef STRING_HAS_SSE2
+        while (x.at_boundary() && y.at_boundary() && x.offset() + 16 <= a.size() && y.offset() + 16 <= b.size()) {
+            __m128i u = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.begin() + x.offset()));
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.begin() + y.offset()));
+            if (_mm_movemask_epi8(_mm_or_si128(u, v))) break;
+            u = fold_ascii_block(u);
+            v = fold_ascii_block(v);
+            int diff = _mm_movemask_epi8(_mm_cmpeq_epi8(u, v)) ^ 0xFFFF;
+            if (diff) {
+                unsigned k = count_trailing_zeros(unsigned(diff));
+                return fold_ascii(a.begin()[x.offset() + k]) < fold_ascii(b.begin()[y.offset() + k]) ? -1 : 1;
+            }
+            x.skip(16);
+            y.skip(16);
+        }
+#endif
+        if (x.done() || y.done()) return x.done() ? (y.done() ? 0 : -1) : 1;
+        char32_t c = x.next(), d = y.next();
+        if (c != d) return c < d ? -1 : 1;
+    }
+}
+
+inline bool equals_ci(StringView<char> a, StringView<char> b, CaseFolding folding = CaseFolding::Unicode) {
+    if (folding == CaseFolding::Ascii && a.size() != b.size()) return false;
+    return compare_ci(a, b, folding) == 0;
+}
+
+// Хеш згорнутого рядка, узгоджений з equals_ci для того ж режиму
+inline uint64_t hash_ci(StringView<char> s, CaseFolding folding = CaseFolding::Unicode) {
+    StringHasher h;
+    FoldCursor x(s, folding);
+    while (!x.done()) {
+#ifdef STRING_HAS_SSE2
+        if (x.at_boundary() && x.offset() + 16 <= s.size()) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.begin() + x.offset()));
+            if (!_mm_movemask_epi8(v)) {
+                alignas(16) char block[16];
+                _mm_store_si128(reinterpret_cast<__m128i*>(block), fold_ascii_block(v));
+                h.update(block, 16);
+                x.skip(16);
+                continue;
+            }
+        }
+#endif
+        char32_t c = x.next();
+        char buf[4];
+        if (c & 0x80000000) {
+            buf[0] = char(c & 0xFF);
+            h.update(buf, 1);
+        } else {
+            h.update(buf, utf8_encode(c, buf));
+        }
+    }
+    return h.finish();
+}
+
+// Перша позиція (у байтах) від from, з якої згорнутий haystack починається зі згорнутого needle;
+// збіг починається і закінчується на межах кодових точок
+inline size_t find_ci(StringView<char> haystack, StringView<char> needle, size_t from = 0,
+                      CaseFolding folding = CaseFolding::Unicode) {
+    const size_t npos = StringView<char>::npos;
+    if (from > haystack.size()) return npos;
+    String<char32_t> target;
+    for (FoldCursor y(needle, folding); !y.done();) target += y.next();
+    if (target.empty()) return from;
+    const char* p = haystack.begin();
+    size_t n = haystack.size();
+    auto matches_at = [&](size_t pos) {
+        FoldCursor x(haystack.substr(pos, n), folding);
+        for (char32_t t : target)
+            if (x.done() || x.next() != t) return false;
+        return x.at_boundary();
+    };
+    // Кандидати: байти, що згортаються в перший символ, та старші байти UTF-8 (можуть згорнутися в ASCII)
+    char first = target[0] < 0x80 ? char(target[0]) : 0;
+    char firstUpper = (first >= 'a' && first <= 'z') ? char(first - 32) : first;
+    size_t i = from;
+    while (i < n) {
+#ifdef STRING_HAS_SSE2
+        if (first && i + 16 <= n) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(first)), _mm_cmpeq_epi8(v, _mm_set1_epi8(firstUpper)));
+            const __m128i lead = _mm_set1_epi8(char(0xC0));
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_max_epu8(v, lead), v));
+            int m = _mm_movemask_epi8(hit);
+            if (!m) {
+                i += 16;
+                continue;
+            }
+            i += count_trailing_zeros(unsigned(m));
+        }
+#endif
+        if ((static_cast<unsigned char>(p[i]) & 0xC0) != 0x80 && matches_at(i)) return i;
+        ++i;
+    }
+    return npos;
+}
+
+inline int compare_ci(const String<char>& a, const String<char>& b, CaseFolding folding = CaseFolding::Unicode) {
+    return compare_ci(a.view(), b.view(), folding);
+}
+
+inline bool equals_ci(const String<char>& a, const String<char>& b, CaseFolding folding = CaseFolding::Unicode) {
+    return equals_ci(a.view(), b.view(), folding);
+}
+
+inline uint64_t hash_ci(const String<char>& s, CaseFolding folding = CaseFolding::Unicode) {
+    return hash_ci(s.view(), folding);
+}
+
+inline size_t find_ci(const String<char>& haystack, const String<char>& needle, size_t from = 0,
+                      CaseFolding folding = CaseFolding::Unicode) {
+    return find_ci(haystack.view(), needle.view(), from, folding);
+}
+
+// Функтори для std::map / std::unordered_map з ключами без урахування регістру
+struct CaseInsensitiveLess {
+    CaseFolding folding = CaseFolding::Unicode;
+    bool operator()(const String<char>& a, const String<char>& b) const { return compare_ci(a, b, folding) < 0; }
+};
+
+struct CaseInsensitiveEqual {
+    CaseFolding folding = CaseFolding::Unicode;
+    bool operator()(const String<char>& a, const String<char>& b) const { return equals_ci(a, b, folding); }
+};
+
+struct CaseInsensitiveHash {
+    CaseFolding folding = CaseFolding::Unicode;
+    size_t operator()(const String<char>& s) const { return size_t(hash_ci(s, folding)); }
+};
+
+// Ключі сортування з урахуванням мови (за зразком UCA, без змінних ваг)
+// Ключ — три рівні: основні ваги (літера), вторинні (діакритика), третинні (регістр),
+// тож порівняння рядків за абеткою зводиться до memcmp ключів. Порядок літер задає абетка
+// (tailoring): літера з абетки — окрема основна вага (українські ї, й не є и/і з діакритикою),
+// решта літер розкладаються (NFD) на базу з абетки та діакритичні знаки.
+class Collator {
+public:
+    // alphabet — малі літери в порядку сортування, UTF-8
+    explicit Collator(const String<char>& alphabet) {
+        uint16_t index = 0;
+        for (size_t i = 0; i < alphabet.size();) {
+            char32_t cp;
+            i += utf8_decode(alphabet.begin() + i, alphabet.size() - i, cp);
+            if (cp != kInvalidCodePoint && !letters.get_pending(cp)) letters.set(cp, ++index);
+        }
+        letters.finish();
+    }
+
+    // Латиниця, за нею кирилиця в порядку української абетки
+    static const Collator& standard() {
+        static const Collator c(String<char>("abcdefghijklmnopqrstuvwxyz"
+                                             "абвгґдеєжзиіїйклмнопрстуфхцчшщьюя"));
+        return c;
+    }
+
+    String<char> sort_key(const String<char>& s) const {
+        String<char> scratch;
+        StringView<char> text = normalized_view(s, NormalizationForm::NFC, scratch);
+        String<char> primary, secondary, tertiary;
+        primary.reserve(text.size() * 3);
+        String<char32_t> parts;
+        for (size_t i = 0; i < text.size();) {
+            char32_t cp;
+            size_t len = utf8_decode(text.begin() + i, text.size() - i, cp);
+            if (cp == kInvalidCodePoint) cp = char32_t(0xDC00 | static_cast<unsigned char>(text.begin()[i]));
+            i += len;
+            char32_t lower = UnicodeCase::map_simple(cp, CaseMapping::Lower);
+            uint32_t caseWeight = lower != cp ? 2 : 1;
+            parts.clear();
+            if (letters[lower]) parts += lower;
+            else UnicodeNormalizer::decompose(lower, false, parts);
+            for (char32_t part : parts) {
+                if (UnicodeNormalizer::combining_class(part)) {
+                    put(secondary, mark_weight(part), 2);
+                    continue;
+                }
+                put(primary, primary_weight(part), 3);
+                put(secondary, kCommonSecondary, 2);
+                put(tertiary, caseWeight, 1);
+            }
+        }
+        String<char> key = std::move(primary);
+        key.append("\0\0\0", 3).append(secondary.begin(), secondary.size());
+        key.append("\0\0", 2).append(tertiary.begin(), tertiary.size());
+        return key;
+    }
+
+    int compare(const String<char>& a, const String<char>& b) const {
+        return compare_keys(sort_key(a), sort_key(b));
+    }
+
+    // Порівняння ключів як беззнакових байтів
+    static int compare_keys(const String<char>& a, const String<char>& b) {
+        int c = std::memcmp(a.begin(), b.begin(), std::min(a.size(), b.size()));
+        if (c) return c;
+        return a.size() < b.size() ? -1 : a.size() > b.size() ? 1 : 0;
+    }
+
+private:
+    static constexpr uint32_t kPunctuationBase = 0x10;
+    static constexpr uint32_t kDigitBase = 0x100;
+    static constexpr uint32_t kLetterBase = 0x200;
+    static constexpr uint32_t kOtherBase = 0x10000;
+    static constexpr uint32_t kCommonSecondary = 1;
+
+    CodePointTable<uint16_t> letters;
+
+    uint32_t primary_weight(char32_t cp) const {
+        if (uint16_t index = letters[cp]) return kLetterBase + index;
+        if (cp >= '0' && cp <= '9') return kDigitBase + (cp - '0');
+        if (cp < 0x80) return kPunctuationBase + cp;
+        return kOtherBase + cp;
+    }
+
+    static uint32_t mark_weight(char32_t mark) {
+        if (mark >= 0x300 && mark < 0x370) return 2 + (mark - 0x300);
+        return 0x100 + mark % 0xFE00;
+    }
+
+    // Вага фіксованої ширини, старший байт першим
+    static void put(String<char>& key, uint32_t weight, size_t bytes) {
+        for (size_t k = bytes; k-- > 0;) key += char((weight >> (8 * k)) & 0xFF);
+    }
+};
+
+// Сортування за абеткою: ключ кожного рядка обчислюється один раз і зберігається поруч із ним
+inline void sort_collated(std::vector<String<char>>& items, const Collator& collator = Collator::standard()) {
+    std::vector<std::pair<String<char>, size_t>> keyed;
+    keyed.reserve(items.size());
+    for (size_t i = 0; i < items.size(); ++i) keyed.emplace_back(collator.sort_key(items[i]), i);
+    std::stable_sort(keyed.begin(), keyed.end(), [](const auto& a, const auto& b) {
+        return Collator::compare_keys(a.first, b.first) < 0;
+    });
+    std::vector<String<char>> sorted;
+    sorted.reserve(items.size());
+    for (auto& k : keyed) sorted.push_back(std::move(items[k.second]));
+    items = std::move(sorted);
+}
+
+// Суфіксний масив з LCP і розрідженою таблицею мінімумів
+// lce(i, j) — довжина найдовшого спільного префікса суфіксів i та j за O(1) після O(n log n) побудови.
+// Індекси 32-бітні: рядки довжиною від 2^32 не підтримуються.
+template <typename T>
+class SuffixArray {
+public:
+    explicit SuffixArray(const String<T>& s) : text(s) {
+        if (text.size() >= UINT32_MAX) throw StringException("Text is too long for a suffix array.");
+        build_suffixes();
+        build_lcp();
+        build_sparse_table();
+    }
+
+    size_t size() const { return sa.size(); }
+
+    // Початок суфікса, що стоїть k-м у лексикографічному порядку
+    size_t suffix(size_t k) const {
+        if (k >= sa.size()) throw OutOfRangeException(k);
+        return sa[k];
+    }
+
+    // Найдовше спільне продовження суфіксів, що починаються в i та j
+    size_t lce(size_t i, size_t j) const {
+        size_t n = sa.size();
+        if (i >= n) throw OutOfRangeException(i);
+        if (j >= n) throw OutOfRangeException(j);
+        if (i == j) return n - i;
+        size_t a = rank[i], b = rank[j];
+        if (a > b) std::swap(a, b);
+        return range_min(a + 1, b);
+    }
+
+    // Найдовший підрядок, що трапляється щонайменше двічі (порожній, якщо такого немає)
+    String<T> longest_repeated_substring() const {
+        size_t best = 0, at = 0;
+        for (size_t k = 1; k < lcp.size(); ++k)
+            if (lcp[k] > best) {
+                best = lcp[k];
+                at = sa[k];
+            }
+        return text.substr(at, best);
+    }
+
+    // Кількість різних непорожніх підрядків: n(n+1)/2 - сума LCP
+    uint64_t distinct_substrings() const {
+        uint64_t n = sa.size();
+        uint64_t total = n * (n + 1) / 2;
+        for (uint32_t v : lcp) total -= v;
+        return total;
+    }
+
+private:
+    String<T> text;
+    std::vector<uint32_t> sa;
+    std::vector<uint32_t> rank;
+    // lcp[k] — спільний префікс суфіксів sa[k - 1] і sa[k]; lcp[0] = 0
+    std::vector<uint32_t> lcp;
+    std::vector<std::vector<uint32_t>> sparse;
+
+    // Подвоєння префіксів із сортуванням підрахунком на кожному кроці
+    void build_suffixes() {
+        size_t n = text.size();
+        const T* p = text.begin();
+        sa.resize(n);
+        rank.assign(n, 0);
+        if (!n) return;
+        for (size_t i = 0; i < n; ++i) sa[i] = uint32_t(i);
+        std::sort(sa.begin(), sa.end(), [p](uint32_t a, uint32_t b) { return p[a] < p[b]; });
+        size_t classes = 1;
+        for (size_t i = 1; i < n; ++i) {
+            if (p[sa[i - 1]] < p[sa[i]]) ++classes;
+            rank[sa[i]] = uint32_t(classes - 1);
+        }
+        std::vector<uint32_t> tmp(n), count;
+        for (size_t k = 1; classes < n; k <<= 1) {
+            size_t w = 0;
+            for (size_t i = n - std::min(k, n); i < n; ++i) tmp[w++] = uint32_t(i);
+            for (size_t i = 0; i < n; ++i)
+                if (sa[i] >= k) tmp[w++] = uint32_t(sa[i] - k);
+            count.assign(classes + 1, 0);
+            for (size_t i = 0; i < n; ++i) ++count[rank[i] + 1];
+            for (size_t c = 1; c <= classes; ++c) count[c] += count[c - 1];
+            for (size_t i = 0; i < n; ++i) sa[count[rank[tmp[i]]]++] = tmp[i];
+            auto second = [&](uint32_t x) { return x + k < n ? int64_t(rank[x + k]) : int64_t(-1); };
+            tmp[sa[0]] = 0;
+            classes = 1;
+            for (size_t i = 1; i < n; ++i) {
+                if (rank[sa[i - 1]] != rank[sa[i]] || second(sa[i - 1]) != second(sa[i])) ++classes;
+                tmp[sa[i]] = uint32_t(classes - 1);
+            }
+            rank.swap(tmp);
+        }
+    }
+
+    // Алгоритм Касаї
+    void build_lcp() {
+        size_t n = sa.size();
+        const T* p = text.begin();
+        lcp.assign(n, 0);
+        size_t h = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (rank[i] == 0) {
+                h = 0;
+                continue;
+            }
+            size_t j = sa[rank[i] - 1];
+            while (i + h < n && j + h < n && p[i + h] == p[j + h]) ++h;
+            lcp[rank[i]] = uint32_t(h);
+            if (h) --h;
+        }
+    }
+
+    void build_sparse_table() {
+        sparse.assign(1, lcp);
+        for (size_t len = 2; len <= lcp.size(); len <<= 1) {
+            const std::vector<uint32_t>& prev = sparse.back();
+            std::vector<uint32_t> level(lcp.size() - len + 1);
+            for (size_t i = 0; i < level.size(); ++i) level[i] = std::min(prev[i], prev[i + len / 2]);
+            sparse.push_back(std::move(level));
+        }
+    }
+
+    // Мінімум lcp[l..r] включно
+    size_t range_min(size_t l, size_t r) const {
+        size_t level = 63 - size_t(count_leading_zeros64(uint64_t(r - l + 1)));
+        return std::min(sparse[level][l], sparse[level][r - (size_t(1) << level) + 1]);
+    }
+};
+
+// Суфіксний автомат, що нарощується разом із рядком
+// Підключений до String<T> автомат дописує кожен новий елемент за амортизоване O(log σ),
+// тож запити «чи є підрядком», кількість входжень і найдовший спільний підрядок працюють
+// за час, лінійний від довжини запиту, без перебудови індексу. Після зміни вже наявних
+// елементів (operator[], set, apply, присвоєння тощо) автомат перебудовується при наступному запиті.
+template <typename T>
+class SuffixAutomaton : public StringObserver<T> {
+public:
+    SuffixAutomaton() { reset(); }
+
+    explicit SuffixAutomaton(StringView<T> text) {
+        reset();
+        extend(text.begin(), text.size());
+    }
+
+    // Індексує поточний вміст source і стежить за подальшими змінами
+    explicit SuffixAutomaton(String<T>& source) : SuffixAutomaton(source.view()) { source.attach(*this); }
+
+    void extend(const T& ch) {
+        if (indexed >= UINT32_MAX / 2) throw StringException("Text is too long for a suffix automaton.");
+        uint32_t cur = new_state(states[last].len + 1, true);
+        uint32_t p = last;
+        while (p != kNone && !states[p].next.count(ch)) {
+            states[p].next[ch] = cur;
+            p = states[p].link;
+        }
+        if (p == kNone) {
+            states[cur].link = 0;
+        } else {
+            uint32_t q = states[p].next[ch];
+            if (states[p].len + 1 == states[q].len) {
+                states[cur].link = q;
+            } else {
+                uint32_t clone = new_state(states[p].len + 1, false);
+                states[clone].next = states[q].next;
+                states[clone].link = states[q].link;
+                while (p != kNone) {
+                    auto it = states[p].next.find(ch);
+                    if (it == states[p].next.end() || it->second != q) break;
+                    it->second = clone;
+                    p = states[p].link;
+                }
+                states[q].link = clone;
+                states[cur].link = clone;
+            }
+        }
+        last = cur;
+        ++indexed;
+        countsReady = false;
+    }
+
+    void extend(const T* src, size_t n) {
+        for (size_t i = 0; i < n; ++i) extend(src[i]);
+    }
+
+    // Кількість проіндексованих елементів і станів автомата
+    size_t size() const {
+        sync();
+        return indexed;
+    }
+
+    size_t state_count() const {
+        sync();
+        return states.size();
+    }
+
+    bool contains(StringView<T> pattern) const { return walk(pattern) != kNone; }
+    bool contains(const String<T>& pattern) const { return contains(pattern.view()); }
+
+    // Кількість (можливо, перекривних) входжень; для порожнього зразка — size() + 1
+    size_t occurrences(StringView<T> pattern) const {
+        uint32_t v = walk(pattern);
+        if (v == kNone) return 0;
+        if (pattern.empty()) return indexed + 1;
+        if (!countsReady) count_endpos();
+        return endpos[v];
+    }
+
+    size_t occurrences(const String<T>& pattern) const { return occurrences(pattern.view()); }
+
+    // Найдовший підрядок other, що трапляється і в проіндексованому тексті (перший з найдовших)
+    StringView<T> longest_common_substring(StringView<T> other) const {
+        sync();
+        uint32_t v = 0;
+        size_t len = 0, best = 0, bestEnd = 0;
+        for (size_t i = 0; i < other.size(); ++i) {
+            const T& ch = other.begin()[i];
+            while (v && !states[v].next.count(ch)) {
+                v = states[v].link;
+                len = states[v].len;
+            }
+            auto it = states[v].next.find(ch);
+            if (it != states[v].next.end()) {
+                v = it->second;
+                ++len;
+            }
+            if (len > best) {
+                best = len;
+                bestEnd = i + 1;
+            }
+        }
+        return other.substr(bestEnd - best, best);
+    }
+
+    String<T> longest_common_substring(const String<T>& other) const {
+        return String<T>(longest_common_substring(other.view()));
+    }
+
+    void on_append(const T* data, size_t length, size_t added) override {
+        if (!stale && length - added == indexed) extend(data + length - added, added);
+        else stale = true;
+    }
+
+    void on_modify(const T*, size_t, size_t, size_t count) override {
+        if (count) stale = true;
+    }
+
+    void on_reset(const T*, size_t) noexcept override { stale = true; }
+
+private:
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    struct State {
+        uint32_t len;
+        uint32_t link;
+        bool primary;  // не клон: відповідає кінцю одного з префіксів
+        std::map<T, uint32_t> next;
+    };
+
+    // mutable: запити перебудовують автомат і лічильники ліниво
+    mutable std::vector<State> states;
+    mutable std::vector<uint32_t> endpos;
+    mutable uint32_t last = 0;
+    mutable size_t indexed = 0;
+    mutable bool countsReady = false;
+    mutable bool stale = false;
+
+    uint32_t new_state(uint32_t len, bool primary) const {
+        states.push_back(State{len, kNone, primary, {}});
+        return uint32_t(states.size() - 1);
+    }
+
+    void reset() const {
+        states.clear();
+        last = 0;
+        indexed = 0;
+        countsReady = false;
+        new_state(0, false);
+    }
+
+    // Перебудова з рядка-джерела, якщо його вміст змінився не лише дописуванням;
+    // без джерела (рядок знищено) лишається останній проіндексований стан
+    void sync() const {
+        if (!stale) return;
+        stale = false;
+        SuffixAutomaton& self = const_cast<SuffixAutomaton&>(*this);
+        String<T>* s = self.source();
+        if (!s) return;
+        reset();
+        self.extend(s->begin(), s->size());
+    }
+
+    uint32_t walk(StringView<T> pattern) const {
+        sync();
+        uint32_t v = 0;
+        for (const T& ch : pattern) {
+            auto it = states[v].next.find(ch);
+            if (it == states[v].next.end()) return kNone;
+            v = it->second;
+        }
+        return v;
+    }
+
+    // |endpos| кожного стану: стани в порядку спадання len, лічильник передається по суфіксних посиланнях
+    void count_endpos() const {
+        size_t n = states.size();
+        std::vector<uint32_t> bucket(indexed + 2, 0), order(n);
+        for (const State& st : states) ++bucket[st.len + 1];
+        for (size_t l = 1; l < bucket.size(); ++l) bucket[l] += bucket[l - 1];
+        for (size_t v = 0; v < n; ++v) order[bucket[states[v].len]++] = uint32_t(v);
+        endpos.assign(n, 0);
+        for (size_t v = 0; v < n; ++v) endpos[v] = states[v].primary ? 1 : 0;
+        for (size_t k = n; k-- > 1;) {
+            uint32_t v = order[k];
+            if (states[v].link != kNone) endpos[states[v].link] += endpos[v];
+        }
+        countsReady = true;
+    }
+};
+
+// Багаторазовий пошук одного зразка: зразок обробляється один раз у конструкторі.
+// Алгоритм обирається за статистикою зразка: 1 байт — memchr; короткий або з бідним алфавітом —
+// SIMD-фільтр за парою байтів; довгий — Хорспул. Після побудови об'єкт лише читається,
+// тож один Searcher можна використовувати з кількох потоків одночасно.
+class Searcher {
+public:
+    enum class Algorithm { Empty, SingleByte, PairFilter, Horspool };
+
+    explicit Searcher(StringView<char> pattern) : needle(pattern) { prepare(); }
+    explicit Searcher(const String<char>& pattern) : needle(pattern) { prepare(); }
+
+    Algorithm algorithm() const { return chosen; }
+    size_t pattern_size() const { return needle.size(); }
+
+    // Перше входження від позиції from або npos
+    size_t find(StringView<char> text, size_t from = 0, const CancellationToken* token = nullptr) const {
+        size_t found = StringView<char>::npos;
+        for_each_match(text, from, token, [&found](size_t pos) {
+            found = pos;
+            return false;
+        });
+        return found;
+    }
+
+    size_t find(const String<char>& text, size_t from = 0, const CancellationToken* token = nullptr) const {
+        return find(text.view(), from, token);
+    }
+
+    // Усі входження, зокрема перекривні, у порядку зростання
+    std::vector<size_t> find_all(StringView<char> text, const CancellationToken* token = nullptr) const {
+        std::vector<size_t> positions;
+        for_each_match(text, 0, token, [&positions](size_t pos) {
+            positions.push_back(pos);
+            return true;
+        });
+        return positions;
+    }
+
+    std::vector<size_t> find_all(const String<char>& text, const CancellationToken* token = nullptr) const {
+        return find_all(text.view(), token);
+    }
+
+    // Кількість входжень, зокрема перекривних
+    size_t count(StringView<char> text, const CancellationToken* token = nullptr) const {
+        size_t total = 0;
+        for_each_match(text, 0, token, [&total](size_t) {
+            ++total;
+            return true;
+        });
+        return total;
+    }
+
+    size_t count(const String<char>& text, const CancellationToken* token = nullptr) const {
+        return count(text.view(), token);
+    }
+
+private:
+    // Від цієї довжини (за достатньо різноманітного алфавіту) зсуви Хорспула окупаються
+    static constexpr size_t kLongPattern = 32;
+    static constexpr size_t kMinDistinctBytes = 8;
+
+    String<char> needle;
+    Algorithm chosen = Algorithm::Empty;
+    // Зміщення байтів-якорів фільтра; second вказує на байт, відмінний від першого, якщо такий є
+    size_t anchorFirst = 0, anchorSecond = 0;
+    std::array<size_t, 256> shift{};
+
+    // visit(pos) для входжень від from, доки visit повертає true; з токеном текст проходиться
+    // вікнами по kCheckInterval можливих початків збігу
+    template <typename Visit>
+    void for_each_match(StringView<char> text, size_t from, const CancellationToken* token, Visit visit) const {
+        const size_t npos = StringView<char>::npos;
+        size_t n = text.size(), m = needle.size();
+        if (from > n || m > n - from) return;
+        size_t lastStart = n - m;
+        size_t step = token ? CancellationToken::kCheckInterval : npos;
+        for (size_t start = from; start <= lastStart;) {
+            if (token) token->check();
+            size_t stop = lastStart - start < step ? lastStart + 1 : start + step;
+            size_t window = stop - 1 + m;
+            for (size_t pos = find_in(text.begin(), window, start); pos != npos; pos = find_in(text.begin(), window, pos + 1))
+                if (!visit(pos)) return;
+            start = stop;
+        }
+    }
+
+    size_t find_in(const char* p, size_t n, size_t from) const {
+        const size_t npos = StringView<char>::npos;
+        size_t m = needle.size();
+        if (from > n || m > n - from) return npos;
+        switch (chosen) {
+            case Algorithm::Empty:
+                return from;
+            case Algorithm::SingleByte: {
+                const void* hit = std::memchr(p + from, needle[0], n - from);
+                return hit ? size_t(static_cast<const char*>(hit) - p) : npos;
+            }
+            case Algorithm::PairFilter:
+                return find_pair(p, n, from);
+            case Algorithm::Horspool:
+                return find_horspool(p, n, from);
+        }
+        return npos;
+    }
+
+    void prepare() {
+        size_t m = needle.size();
+        const unsigned char* q = reinterpret_cast<const unsigned char*>(needle.begin());
+        if (m == 0) {
+            chosen = Algorithm::Empty;
+            return;
+        }
+        if (m == 1) {
+            chosen = Algorithm::SingleByte;
+            return;
+        }
+        std::array<bool, 256> seen{};
+        size_t distinct = 0;
+        for (size_t i = 0; i < m; ++i)
+            if (!seen[q[i]]) {
+                seen[q[i]] = true;
+                ++distinct;
+            }
+        if (m >= kLongPattern && distinct >= kMinDistinctBytes) {
+            chosen = Algorithm::Horspool;
+            shift.fill(m);
+            for (size_t i = 0; i + 1 < m; ++i) shift[q[i]] = m - 1 - i;
+            return;
+        }
+        chosen = Algorithm::PairFilter;
+        anchorSecond = m - 1;
+        while (anchorSecond > 0 && q[anchorSecond] == q[0]) --anchorSecond;
+        if (anchorSecond == 0) anchorSecond = m - 1;
+    }
+
+    bool matches_at(const char* p, size_t pos) const {
+        return std::memcmp(p + pos, needle.begin(), needle.size()) == 0;
+    }
+
+    size_t find_pair(const char* p, size_t n, size_t from) const {
+        size_t m = needle.size();
+        size_t last = n - m;  // найбільша допустима позиція
+        size_t i = from;
+        char a = needle.begin()[anchorFirst], b = needle.begin()[anchorSecond];
+#ifdef STRING_HAS_SSE2
+        const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+        while (i <= last && last - i >= 15) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + anchorFirst));
+            __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + anchorSecond));
+            unsigned mask = unsigned(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(x, va), _mm_cmpeq_epi8(y, vb))));
+            while (mask) {
+                size_t pos = i + count_trailing_zeros(mask);
+                if (matches_at(p, pos)) return pos;
+                mask &= mask - 1;
+            }
+            i += 16;
+        }
+#endif
+        for (; i <= last; ++i)
+            if (p[i + anchorFirst] == a && p[i + anchorSecond] == b && matches_at(p, i)) return i;
+        return StringView<char>::npos;
+    }
+
+    size_t find_horspool(const char* p, size_t n, size_t from) const {
+        size_t m = needle.size();
+        const char* q = needle.begin();
+        char tail = q[m - 1];
+        for (size_t i = from; i + m <= n;) {
+            char c = p[i + m - 1];
+            if (c == tail && std::memcmp(p + i, q, m - 1) == 0) return i;
+            i += shift[static_cast<unsigned char>(c)];
+        }
+        return StringView<char>::npos;
+    }
+};
+
+// Фільтр зозулі: наближена перевірка належності з видаленням
+// Кошик — 4 відбитки по 16 біт; обидва кошики ключа перевіряються однією SSE2-інструкцією порівняння.
+// Довжина відбитка f обирається з бажаної частоти хибних спрацьовувань ε: 2·4 / 2^f ≤ ε
+// (f ≤ 16, тож ε < 2^-13 недосяжна — конструктор кидає виняток).
+// Хибнонегативних відповідей немає, доки видаляються лише раніше вставлені ключі.
+class CuckooFilter {
+public:
+    explicit CuckooFilter(size_t capacity, double falsePositiveRate = 0.01) {
+        if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0))
+            throw StringException("False positive rate must be in (0, 1).");
+        while (fpBits < 16 && double(2 * kBucketSlots) / double(uint32_t(1) << fpBits) > falsePositiveRate) ++fpBits;
+        if (double(2 * kBucketSlots) / 65536.0 > falsePositiveRate)
+            throw StringException("False positive rate below 2^-13 needs fingerprints wider than 16 bits.");
+        fpMask = uint16_t((uint32_t(1) << fpBits) - 1);
+        // Заповненість до ~95% для кошиків на 4 місця
+        if (capacity > SIZE_MAX / 100) throw std::bad_alloc();
+        size_t wanted = std::max<size_t>(1, (capacity * 100 / 95 + kBucketSlots - 1) / kBucketSlots);
+        size_t buckets = 1;
+        while (buckets < wanted) {
+            if (buckets > SIZE_MAX / (2 * kBucketSlots)) throw std::bad_alloc();
+            buckets <<= 1;
+        }
+        bucketMask = buckets - 1;
+        slots.assign(buckets * kBucketSlots, 0);
+    }
+
+    // false — фільтр переповнений (ключ усе одно запам'ятовано у запасному слоті, але нові вже не вміщуються)
+    template <typename T>
+    bool insert(StringView<T> key) {
+        if (hasVictim) return false;
+        Probe pr = probe(key);
+        if (put(pr.first, pr.fp) || put(pr.second, pr.fp)) {
+            ++count;
+            return true;
+        }
+        size_t index = (rng() & 1) ? pr.first : pr.second;
+        uint16_t fp = pr.fp;
+        for (size_t kick = 0; kick < kMaxKicks; ++kick) {
+            uint16_t& slot = slots[index * kBucketSlots + rng() % kBucketSlots];
+            std::swap(fp, slot);
+            index = alternate(index, fp);
+            if (put(index, fp)) {
+                ++count;
+                return true;
+            }
+        }
+        victim = fp;
+        victimIndex = index;
+        hasVictim = true;
+        ++count;
+        return false;
+    }
+
+    // Чи (ймовірно) траплявся ключ
+    template <typename T>
+    bool contains(StringView<T> key) const {
+        Probe pr = probe(key);
+        if (hasVictim && victim == pr.fp && (victimIndex == pr.first || victimIndex == pr.second)) return true;
+        return in_buckets(pr);
+    }
+
+    // Видаляє одну копію ключа; видаляти можна лише те, що вставлялося
+    template <typename T>
+    bool erase(StringView<T> key) {
+        Probe pr = probe(key);
+        if (remove(pr.first, pr.fp) || remove(pr.second, pr.fp)) {
+            --count;
+            reinsert_victim();
+            return true;
+        }
+        if (hasVictim && victim == pr.fp && (victimIndex == pr.first || victimIndex == pr.second)) {
+            hasVictim = false;
+            --count;
+            return true;
+        }
+        return false;
+    }
+
+    // «Чи траплявся раніше?»: true, якщо ключ (імовірно) вже був; інакше вставляє його.
+    // Якщо ключ уже нікуди записати (запасний слот зайнятий), кидає StringException —
+    // мовчки пропущений ключ дав би хибне «ні» наступного разу
+    template <typename T>
+    bool test_and_insert(StringView<T> key) {
+        if (contains(key)) return true;
+        if (hasVictim) throw StringException("Cuckoo filter is full.");
+        insert(key);
+        return false;
+    }
+
+    template <typename T>
+    bool insert(const String<T>& key) { return insert(key.view()); }
+    template <typename T>
+    bool contains(const String<T>& key) const { return contains(key.view()); }
+    template <typename T>
+    bool erase(const String<T>& key) { return erase(key.view()); }
+    template <typename T>
+    bool test_and_insert(const String<T>& key) { return test_and_insert(key.view()); }
+
+    size_t size() const { return count; }
+    size_t bucket_count() const { return bucketMask + 1; }
+    unsigned fingerprint_bits() const { return fpBits; }
+    size_t memory_bytes() const { return slots.size() * sizeof(uint16_t); }
+
+private:
+    static constexpr size_t kBucketSlots = 4;
+    static constexpr size_t kMaxKicks = 500;
+
+    struct Probe {
+        size_t first, second;
+        uint16_t fp;
+    };
+
+    std::vector<uint16_t> slots;  // 0 — порожнє місце
+    size_t bucketMask = 0;
+    size_t count = 0;
+    unsigned fpBits = 4;
+    uint16_t fpMask = 0;
+    uint16_t victim = 0;
+    size_t victimIndex = 0;
+    bool hasVictim = false;
+    uint64_t rngState = 0x9E3779B97F4A7C15ULL;
+
+    template <typename T>
+    Probe probe(StringView<T> key) const {
+        uint64_t h = hash_bytes(key.begin(), key.size() * sizeof(T));
+        Probe pr;
+        pr.fp = uint16_t((h >> 32) & fpMask);
+        if (!pr.fp) pr.fp = 1;
+        pr.first = size_t(h) & bucketMask;
+        pr.second = alternate(pr.first, pr.fp);
+        return pr;
+    }
+
+    // Другий кошик залежить лише від першого та відбитка, тож переходи симетричні
+    size_t alternate(size_t index, uint16_t fp) const {
+        uint64_t m = uint64_t(fp) * 0x5BD1E9955BD1E995ULL;
+        return (index ^ size_t(m >> 32)) & bucketMask;
+    }
+
+    bool in_buckets(const Probe& pr) const {
+        const uint16_t* a = &slots[pr.first * kBucketSlots];
+        const uint16_t* b = &slots[pr.second * kBucketSlots];
+#ifdef STRING_HAS_SSE2
+        __m128i both = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(a)),
+                                          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(b)));
+        return _mm_movemask_epi8(_mm_cmpeq_epi16(both, _mm_set1_epi16(short(pr.fp)))) != 0;
+#else
+        for (size_t k = 0; k < kBucketSlots; ++k)
+            if (a[k] == pr.fp || b[k] == pr.fp) return true;
+        return false;
+#endif
+    }
+
+    bool put(size_t index, uint16_t fp) {
+        uint16_t* bucket = &slots[index * kBucketSlots];
+        for (size_t k = 0; k < kBucketSlots; ++k)
+            if (!bucket[k]) {
+                bucket[k] = fp;
+                return true;
+            }
+        return false;
+    }
+
+    bool remove(size_t index, uint16_t fp) {
+        uint16_t* bucket = &slots[index * kBucketSlots];
+        for (size_t k = 0; k < kBucketSlots; ++k)
+            if (bucket[k] == fp) {
+                bucket[k] = 0;
+                return true;
+            }
+        return false;
+    }
+
+    // Після видалення звільнене місце може прийняти відбиток із запасного слота
+    void reinsert_victim() {
+        if (!hasVictim) return;
+        if (put(victimIndex, victim) || put(alternate(victimIndex, victim), victim)) hasVictim = false;
+    }
+
+    uint64_t rng() {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 7;
+        rngState ^= rngState << 17;
+        return rngState;
+    }
+};
+
+// Розбиття на фрагменти за вмістом (FastCDC)
+// Межа ставиться там, де Gear-хеш ковзного вікна має нулі під маскою, тож вставка в одному місці
+// зсуває лише сусідні межі. Нормалізація: до середнього розміру маска жорсткіша, після — м'якша,
+// що стискає розподіл розмірів навколо середнього. Перші minSize байтів фрагмента не хешуються.
+struct Chunk {
+    size_t offset;
+    size_t length;
+    uint64_t fingerprint;  // hash_bytes вмісту
+};
+
+class ContentChunker {
+public:
+    explicit ContentChunker(size_t average = 8192, size_t minimum = 0, size_t maximum = 0)
+        : avgSize(average), minSize(minimum ? minimum : average / 4), maxSize(maximum ? maximum : average * 8) {
+        if (avgSize < 64 || (avgSize & (avgSize - 1))) throw StringException("Average chunk size must be a power of two >= 64.");
+        if (minSize > avgSize || maxSize < avgSize) throw StringException("Chunk sizes must satisfy min <= average <= max.");
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < avgSize) ++bits;
+        maskHard = ~uint64_t(0) << (64 - (bits + 2));
+        maskEasy = ~uint64_t(0) << (64 - (bits - 2));
+    }
+
+    // Довжина фрагмента, що починається в p (n — залишок даних)
+    size_t next_cut(const char* p, size_t n) const {
+        if (n <= minSize) return n;
+        const std::array<uint64_t, 256>& gear = gear_table();
+        const unsigned char* q = reinterpret_cast<const unsigned char*>(p);
+        size_t limit = std::min(n, maxSize);
+        size_t normal = std::min(limit, avgSize);
+        uint64_t h = 0;
+        size_t i = minSize;
+        for (; i < normal; ++i) {
+            h = (h << 1) + gear[q[i]];
+            if (!(h & maskHard)) return i + 1;
+        }
+        for (; i < limit; ++i) {
+            h = (h << 1) + gear[q[i]];
+            if (!(h & maskEasy)) return i + 1;
+        }
+        return limit;
+    }
+
+    std::vector<Chunk> split(StringView<char> data) const {
+        std::vector<Chunk> chunks;
+        chunks.reserve(data.size() / avgSize + 1);
+        const char* p = data.begin();
+        for (size_t offset = 0; offset < data.size();) {
+            size_t len = next_cut(p + offset, data.size() - offset);
+            chunks.push_back(Chunk{offset, len, hash_bytes(p + offset, len)});
+            offset += len;
+        }
+        return chunks;
+    }
+
+    std::vector<Chunk> split(const String<char>& data) const { return split(data.view()); }
+
+    size_t average_size() const { return avgSize; }
+    size_t min_size() const { return minSize; }
+    size_t max_size() const { return maxSize; }
+
+private:
+    size_t avgSize, minSize, maxSize;
+    uint64_t maskHard = 0, maskEasy = 0;
+
+    // Випадкові 64-бітні ваги байтів (splitmix64), однакові для всіх запусків
+    static const std::array<uint64_t, 256>& gear_table() {
+        static const std::array<uint64_t, 256> table = [] {
+            std::array<uint64_t, 256> t{};
+            uint64_t x = 0;
+            for (uint64_t& v : t) {
+                uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                v = z ^ (z >> 31);
+            }
+            return t;
+        }();
+        return table;
+    }
+};
+
+// Файл лише для читання: на POSIX відображається в пам'ять, інакше зчитується повністю
+class MappedFile {
+public:
+    explicit MappedFile(const char* path) {
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) throw StringException(std::string("Cannot open file: ") + path);
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw StringException(std::string("Cannot stat file: ") + path);
+        }
+        length = size_t(st.st_size);
+        if (length) {
+            void* p = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw StringException(std::string("Cannot map file: ") + path);
+            }
+            mapped = static_cast<const char*>(p);
+#ifdef MADV_SEQUENTIAL
+            ::madvise(p, length, MADV_SEQUENTIAL);
+#endif
+        }
+        ::close(fd);
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw StringException(std::string("Cannot open file: ") + path);
+        std::ostringstream buffer;
+        buffer << in.rdbuf();
+        std::string bytes = buffer.str();
+        contents = String<char>(bytes.data(), bytes.data() + bytes.size());
+        length = contents.size();
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (mapped) ::munmap(const_cast<char*>(mapped), length);
+#endif
+    }
+
+    size_t size() const { return length; }
+    StringView<char> view() const {
+#if defined(__unix__) || defined(__APPLE__)
+        return StringView<char>(mapped, length);
+#else
+        return contents.view();
+#endif
+    }
+
+private:
+    size_t length = 0;
+#if defined(__unix__) || defined(__APPLE__)
+    const char* mapped = nullptr;
+#else
+    String<char> contents;
+#endif
+};
+
+// Сховище з дедуплікацією: рядки ріжуться на фрагменти за вмістом, однакові фрагменти зберігаються раз.
+// Збіг відбитків перевіряється порівнянням байтів, тож колізії хешу не псують дані.
+class ChunkStore {
+public:
+    struct Stats {
+        size_t blobs = 0;
+        size_t logicalBytes = 0;  // сумарна довжина покладених рядків
+        size_t storedBytes = 0;   // довжина унікальних фрагментів
+        size_t chunkRefs = 0;
+        size_t uniqueChunks = 0;
+    };
+
+    explicit ChunkStore(ContentChunker chunker = ContentChunker()) : chunker(chunker) {}
+
+    // Повертає ідентифікатор для get
+    size_t put(StringView<char> data) {
+        std::vector<size_t> recipe;
+        for (const Chunk& c : chunker.split(data)) {
+            recipe.push_back(intern(data.substr(c.offset, c.length), c.fingerprint));
+            ++totals.chunkRefs;
+        }
+        recipes.push_back(std::move(recipe));
+        ++totals.blobs;
+        totals.logicalBytes += data.size();
+        return recipes.size() - 1;
+    }
+
+    size_t put(const String<char>& data) { return put(data.view()); }
+
+    String<char> get(size_t id) const {
+        if (id >= recipes.size()) throw OutOfRangeException(id);
+        size_t total = 0;
+        for (size_t c : recipes[id]) total += chunks[c].size();
+        String<char> out;
+        out.reserve(total);
+        for (size_t c : recipes[id]) out.append(chunks[c].begin(), chunks[c].size());
+        return out;
+    }
+
+    const Stats& stats() const { return totals; }
+
+private:
+    ContentChunker chunker;
+    std::vector<String<char>> chunks;
+    std::multimap<uint64_t, size_t> byFingerprint;
+    std::vector<std::vector<size_t>> recipes;
+    Stats totals;
+
+    size_t intern(StringView<char> bytes, uint64_t fingerprint) {
+        auto range = byFingerprint.equal_range(fingerprint);
+        for (auto it = range.first; it != range.second; ++it)
+            if (chunks[it->second].view() == bytes) return it->second;
+        chunks.emplace_back(bytes);
+        byFingerprint.emplace(fingerprint, chunks.size() - 1);
+        ++totals.uniqueChunks;
+        totals.storedBytes += bytes.size();
+        return chunks.size() - 1;
+    }
+};
+
+// Форматування з розбором шаблону під час компіляції
+// format<"{}:{}">(a, b): шаблон розбирається компілятором ({{ і }} — літеральні дужки), кількість {}
+// звіряється з кількістю аргументів, довжина результату обчислюється наперед — одне виділення пам'яті.
+// Аргументи: String<T>, StringView<T> (char і char8_t копіюються як є, char16_t/char32_t/wchar_t кодуються
+// в UTF-8 як utf8_encode_units: UTF-16 з парами сурогатів, некоректні одиниці — U+FFFD), const char*,
+// символи char/char8_t/char16_t/char32_t/wchar_t, цілі числа.
+template <typename T>
+size_t format_size(StringView<T> s) {
+    static_assert(kUtf8CodeUnit<T> || kUtf8Transcodable<T>, "format: unsupported character type");
+    if constexpr (kUtf8CodeUnit<T>) return s.size();
+    else return utf8_units_length(s.begin(), s.size());
+}
+
+template <typename T>
+char* format_write(char* out, StringView<T> s) {
+    static_assert(kUtf8CodeUnit<T> || kUtf8Transcodable<T>, "format: unsupported character type");
+    if constexpr (kUtf8CodeUnit<T>) {
+        if (s.size()) std::memcpy(out, s.begin(), s.size());
+        return out + s.size();
+    } else {
+        return out + utf8_encode_units(s.begin(), s.size(), out);
+    }
+}
+
+template <typename T>
+size_t format_size(const String<T>& s) { return format_size(s.view()); }
+
+template <typename T>
+char* format_write(char* out, const String<T>& s) { return format_write(out, s.view()); }
+
+inline size_t format_size(const char* s) { return std::strlen(s); }
+
+inline char* format_write(char* out, const char* s) { return format_write(out, StringView<char>(s, std::strlen(s))); }
+
+inline size_t format_size(char) { return 1; }
+
+inline char* format_write(char* out, char ch) {
+    *out = ch;
+    return out + 1;
+}
+
+#ifdef __cpp_char8_t
+inline size_t format_size(char8_t) { return 1; }
+
+inline char* format_write(char* out, char8_t ch) {
+    *out = char(ch);
+    return out + 1;
+}
+#endif
+
+// char16_t, char32_t і wchar_t — символ (одна кодова одиниця) у UTF-8, а не число
+template <typename C>
+std::enable_if_t<kUtf8Transcodable<C>, size_t> format_size(C ch) { return utf8_units_length(&ch, 1); }
+
+template <typename C>
+std::enable_if_t<kUtf8Transcodable<C>, char*> format_write(char* out, C ch) {
+    return out + utf8_encode_units(&ch, 1, out);
+}
+
+template <typename I>
+using FormatInteger = std::enable_if_t<std::is_integral<I>::value && !std::is_same<I, bool>::value &&
+                                       !kUtf8CodeUnit<I> && !kUtf8Transcodable<I>>;
+
+template <typename I, typename = FormatInteger<I>>
+size_t format_size(I value) {
+    using U = std::make_unsigned_t<I>;
+    U magnitude = value < 0 ? U(0) - U(value) : U(value);
+    size_t digits = 1;
+    while (magnitude >= 10) {
+        magnitude /= 10;
+        ++digits;
+    }
+    return digits + (value < 0 ? 1 : 0);
+}
+
+template <typename I, typename = FormatInteger<I>>
+char* format_write(char* out, I value) {
+    using U = std::make_unsigned_t<I>;
+    U magnitude = value < 0 ? U(0) - U(value) : U(value);
+    if (value < 0) *out++ = '-';
+    char* end = out + format_size(magnitude);
+    char* w = end;
+    do {
+        *--w = char('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+    return end;
+}
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+// Рядковий літерал як параметр шаблону
+template <size_t N>
+struct FormatString {
+    char text[N] = {};
+
+    constexpr FormatString(const char (&s)[N]) {
+        for (size_t i = 0; i < N; ++i) text[i] = s[i];
+    }
+
+    constexpr size_t size() const { return N - 1; }
+};
+
+// Розібраний шаблон: літеральний текст без екранування та межі шматків перед кожним {}
+template <size_t N>
+struct ParsedFormat {
+    char literal[N] = {};
+    size_t literalLength = 0;
+    size_t pieceEnd[N] = {};
+    size_t placeholders = 0;
+    bool valid = true;
+};
+
+template <size_t N>
+constexpr ParsedFormat<N> parse_format(const FormatString<N>& f) {
+    ParsedFormat<N> r;
+    for (size_t i = 0; i < f.size(); ++i) {
+        char c = f.text[i];
+        char next = i + 1 < f.size() ? f.text[i + 1] : '\0';
+        if (c == '{' && next == '}') {
+            r.pieceEnd[r.placeholders++] = r.literalLength;
+            ++i;
+        } else if ((c == '{' || c == '}') && next == c) {
+            r.literal[r.literalLength++] = c;
+            ++i;
+        } else if (c == '{' || c == '}') {
+            r.valid = false;
+        } else {
+            r.literal[r.literalLength++] = c;
+        }
+    }
+    return r;
+}
+
+template <FormatString F, typename... Args>
+String<char> format(const Args&... args) {
+    static constexpr ParsedFormat parsed = parse_format(F);
+    static_assert(parsed.valid, "Invalid format string: use {} for arguments and {{ }} for braces.");
+    static_assert(parsed.placeholders == sizeof...(Args), "Format string and argument count differ.");
+    size_t total = (parsed.literalLength + ... + format_size(args));
+    String<char> out;
+    char* w = out.resize_uninitialized(total);
+    size_t piece = 0, from = 0;
+    auto put = [&](const auto& arg) {
+        size_t end = parsed.pieceEnd[piece++];
+        w = format_write(w, StringView<char>(parsed.literal + from, end - from));
+        from = end;
+        w = format_write(w, arg);
+    };
+    (put(args), ...);
+    (void)put;
+    format_write(w, StringView<char>(parsed.literal + from, parsed.literalLength - from));
+    return out;
+}
+#endif
+
+#ifdef __cpp_lib_format
+// std::format("{:>10}", s): ширина, заповнення та вирівнювання — як у std::string_view,
+// вміст рядка char передається одним шматком без посимвольного виводу
+namespace std {
+template <typename T>
+struct formatter<StringView<T>, char> : formatter<string_view, char> {
+    template <typename FormatContext>
+    auto format(StringView<T> s, FormatContext& ctx) const {
+        if constexpr (is_same<T, char>::value) {
+            return formatter<string_view, char>::format(string_view(s.begin(), s.size()), ctx);
+        } else {
+            string utf8(format_size(s), '\0');
+            format_write(utf8.data(), s);
+            return formatter<string_view, char>::format(string_view(utf8), ctx);
+        }
+    }
+};
+
+template <typename T>
+struct formatter<String<T>, char> : formatter<StringView<T>, char> {
+    template <typename FormatContext>
+    auto format(const String<T>& s, FormatContext& ctx) const {
+        return formatter<StringView<T>, char>::format(s.view(), ctx);
+    }
+};
+}
+#endif
+
+// Спільна пам'ять для передачі рядків між процесами без копіювання
+// Арена — файл shm_open (за іменем) або memfd (анонімна, дескриптор передається нащадку чи через сокет).
+// Записи незмінні й адресуються зміщенням від початку арени, тож зміщення дійсне в кожному процесі,
+// хоч би за якою адресою той відобразив арену. Місце під запис виділяється атомарним зсувом лічильника
+// в самій арені, тому публікувати можуть кілька процесів одночасно. Поза POSIX — StringException.
+class SharedStringArena {
+public:
+    // Нова арена на capacity байтів; name == nullptr — анонімна (memfd на Linux)
+    static SharedStringArena create(const char* name, size_t capacity) {
+#if defined(__unix__) || defined(__APPLE__)
+        if (capacity > UINT64_MAX - kHeaderSize) throw std::bad_alloc();
+        int fd = -1;
+        if (name) {
+            fd = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+        } else {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+            fd = ::memfd_create("string-arena", MFD_CLOEXEC);
+#else
+            throw StringException("Anonymous shared arenas require memfd_create.");
+#endif
+        }
+        if (fd < 0) throw StringException(std::string("Cannot create shared arena: ") + (name ? name : "memfd"));
+        size_t total = kHeaderSize + capacity;
+        if (::ftruncate(fd, off_t(total)) != 0) {
+            ::close(fd);
+            if (name) ::shm_unlink(name);
+            throw StringException("Cannot size shared arena.");
+        }
+        try {
+            SharedStringArena arena(fd, total, true);
+            Header* h = arena.header();
+            new (&h->used) std::atomic<uint64_t>(kHeaderSize);
+            h->capacity = total;
+            std::atomic_thread_fence(std::memory_order_release);
+            h->magic = kMagic;
+            return arena;
+        } catch (...) {
+            if (name) ::shm_unlink(name);
+            throw;
+        }
+#else
+        (void)name;
+        (void)capacity;
+        throw StringException("Shared arenas require POSIX shared memory.");
+#endif
+    }
+
+    // Підключення до арени, створеної іншим процесом
+    static SharedStringArena open(const char* name, bool writable = false) {
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = ::shm_open(name, writable ? O_RDWR : O_RDONLY, 0);
+        if (fd < 0) throw StringException(std::string("Cannot open shared arena: ") + name);
+        return from_fd(fd, writable);
+#else
+        (void)name;
+        (void)writable;
+        throw StringException("Shared arenas require POSIX shared memory.");
+#endif
+    }
+
+    // Підключення за дескриптором (арена переймає його)
+    static SharedStringArena from_fd(int fd, bool writable = false) {
+#if defined(__unix__) || defined(__APPLE__)
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || size_t(st.st_size) < kHeaderSize) {
+            ::close(fd);
+            throw StringException("Not a shared string arena.");
+        }
+        SharedStringArena arena(fd, size_t(st.st_size), writable);
+        if (arena.header()->magic != kMagic || arena.header()->capacity != arena.mappedSize)
+            throw StringException("Not a shared string arena.");
+        return arena;
+#else
+        (void)fd;
+        (void)writable;
+        throw StringException("Shared arenas require POSIX shared memory.");
+#endif
+    }
+
+    // Видалення імені; відображення в процесах лишаються дійсними
+    static void unlink(const char* name) {
+#if defined(__unix__) || defined(__APPLE__)
+        ::shm_unlink(name);
+#else
+        (void)name;
+#endif
+    }
+
+    SharedStringArena(SharedStringArena&& other) noexcept
+        : base(other.base), mappedSize(other.mappedSize), fd(other.fd), writable(other.writable) {
+        other.base = nullptr;
+        other.fd = -1;
+    }
+
+    SharedStringArena& operator=(SharedStringArena&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            base = other.base;
+            mappedSize = other.mappedSize;
+            fd = other.fd;
+            writable = other.writable;
+            other.base = nullptr;
+            other.fd = -1;
+        }
+        return *this;
+    }
+
+    SharedStringArena(const SharedStringArena&) = delete;
+    SharedStringArena& operator=(const SharedStringArena&) = delete;
+
+    ~SharedStringArena() { unmap(); }
+
+    // Копіює рядок в арену й повертає зміщення запису
+    template <typename T>
+    uint64_t publish(StringView<T> s) {
+        static_assert(std::is_trivially_copyable<T>::value, "Shared strings must be trivially copyable.");
+        if (!writable) throw StringException("Shared arena is read-only.");
+        if (s.size() > (mappedSize - kHeaderSize) / sizeof(T)) throw StringException("Shared arena is full.");
+        uint64_t bytes = kRecordSize + ((s.size() * sizeof(T) + kAlign - 1) & ~uint64_t(kAlign - 1));
+        // Місце резервується, лише якщо вміщається: невдала спроба не зсуває лічильник
+        uint64_t at = header()->used.load(std::memory_order_relaxed);
+        do {
+            if (at > mappedSize || bytes > mappedSize - at) throw StringException("Shared arena is full.");
+        } while (!header()->used.compare_exchange_weak(at, at + bytes, std::memory_order_relaxed));
+        Record* r = record(at);
+        r->elementSize = uint32_t(sizeof(T));
+        if (s.size()) std::memcpy(base + at + kRecordSize, s.begin(), s.size() * sizeof(T));
+        // Довжина + 1 пишеться останньою: 0 означає, що запис ще не опубліковано
+        r->lengthPlusOne.store(uint64_t(s.size()) + 1, std::memory_order_release);
+        return at;
+    }
+
+    template <typename T>
+    uint64_t publish(const String<T>& s) { return publish(s.view()); }
+
+    // Перегляд опублікованого запису; дійсний, поки арена відображена
+    template <typename T>
+    StringView<T> view(uint64_t offset) const {
+        if (offset < kHeaderSize || offset % kAlign || offset > mappedSize - kRecordSize) throw OutOfRangeException(size_t(offset));
+        const Record* r = record(offset);
+        uint64_t stored = r->lengthPlusOne.load(std::memory_order_acquire);
+        if (!stored) throw StringException("Shared string is not published yet.");
+        if (r->elementSize != sizeof(T)) throw StringException("Shared string has a different element type.");
+        uint64_t len = stored - 1;
+        if (len > (mappedSize - offset - kRecordSize) / sizeof(T)) throw OutOfRangeException(size_t(offset));
+        return StringView<T>(reinterpret_cast<const T*>(base + offset + kRecordSize), size_t(len));
+    }
+
+    int descriptor() const { return fd; }
+    size_t capacity() const { return mappedSize - kHeaderSize; }
+    size_t used() const { return size_t(std::min<uint64_t>(header()->used.load(std::memory_order_relaxed), mappedSize) - kHeaderSize); }
+
+private:
+    static constexpr uint64_t kMagic = 0x414E455241525453ULL;  // "STRARENA"
+    static constexpr size_t kHeaderSize = 64;
+    static constexpr size_t kRecordSize = 16;
+    static constexpr size_t kAlign = 16;
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared counters must be lock-free.");
+
+    struct Header {
+        uint64_t magic;
+        uint64_t capacity;
+        std::atomic<uint64_t> used;
+    };
+
+    struct Record {
+        std::atomic<uint64_t> lengthPlusOne;
+        uint32_t elementSize;
+        uint32_t reserved;
+    };
+
+    char* base = nullptr;
+    size_t mappedSize = 0;
+    int fd = -1;
+    bool writable = false;
+
+    SharedStringArena(int descriptor, size_t size, bool canWrite) : mappedSize(size), fd(descriptor), writable(canWrite) {
+#if defined(__unix__) || defined(__APPLE__)
+        void* p = ::mmap(nullptr, size, canWrite ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            throw StringException("Cannot map shared arena.");
+        }
+        base = static_cast<char*>(p);
+#endif
+    }
+
+    void unmap() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (base) ::munmap(base, mappedSize);
+        if (fd >= 0) ::close(fd);
+#endif
+        base = nullptr;
+        fd = -1;
+    }
+
+    Header* header() const { return reinterpret_cast<Header*>(base); }
+    Record* record(uint64_t offset) const { return reinterpret_cast<Record*>(base + offset); }
+};
+
+// Потоковий пошук одного чи кількох зразків (Ахо—Корасік, повна таблиця переходів)
+// Стан автомата зберігається між порціями, тож кожен байт обробляється один раз: підключений
+// до рядка матчер сканує лише дописане. Збіги, що перетинають межу порцій, знаходяться.
+// Після зміни вже просканованих байтів стан відновлюється з останніх maxLen байтів при наступному
+// дописуванні; збіги всередині зміненої частини повторно не повідомляються. Після скидання вмісту
+// (присвоєння, очищення, вкорочення) так само: стан мовчки відновлюється з останніх maxLen байтів перших
+// min(length, consumed), а повідомляються лише збіги, що закінчуються далі.
+// Сповіщення рядка (дописування, скидання, зокрема з noexcept-переміщень) не пропускають виняток
+// обробника збігів — інакше рядок уже змінено, а наступні спостерігачі про це не дізналися б.
+// Перший такий виняток відкладається й кидається з наступного feed чи take_matches; сканування триває.
+class StreamingMatcher : public StringObserver<char> {
+public:
+    struct Match {
+        size_t pattern;          // індекс зразка
+        size_t offset;           // початок збігу від початку потоку
+        StringView<char> text;   // збіглий текст (вказує на сам зразок)
+    };
+
+    using Callback = std::function<void(const Match&)>;
+
+    // Без callback збіги накопичуються й забираються take_matches()
+    explicit StreamingMatcher(const std::vector<String<char>>& patterns, Callback callback = nullptr)
+        : patterns(patterns), onMatch(std::move(callback)) { build(); }
+
+    explicit StreamingMatcher(const String<char>& pattern, Callback callback = nullptr)
+        : StreamingMatcher(std::vector<String<char>>{pattern}, std::move(callback)) {}
+
+    // Сканує поточний вміст source і далі — лише дописане
+    void watch(String<char>& source) {
+        reset();
+        advance(source.begin(), source.size());
+        source.attach(*this);
+    }
+
+    void feed(const char* p, size_t n) {
+        rethrow_deferred();
+        advance(p, n);
+    }
+
+    void feed(StringView<char> chunk) { feed(chunk.begin(), chunk.size()); }
+
+    std::vector<Match> take_matches() {
+        rethrow_deferred();
+        std::vector<Match> out;
+        out.swap(pending);
+        return out;
+    }
+
+    // Початок нового потоку
+    void reset() {
+        state = 0;
+        consumed = 0;
+        resync = false;
+    }
+
+    size_t consumed_bytes() const { return consumed; }
+    size_t pattern_count() const { return patterns.size(); }
+
+    void on_append(const char* data, size_t length, size_t added) override {
+        size_t old = length - added;
+        if (old < consumed) {
+            consumed = old;
+            resync = true;
+        }
+        resume(data, consumed);
+        catch_up(data, length);
+    }
+
+    void on_modify(const char*, size_t, size_t pos, size_t count) override {
+        if (count && pos < consumed && pos + count > consumed - std::min(consumed, maxLen)) resync = true;
+    }
+
+    void on_reset(const char* data, size_t length) noexcept override {
+        consumed = std::min(consumed, length);
+        resync = true;
+        resume(data, consumed);
+        catch_up(data, length);
+    }
+
+private:
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    std::vector<String<char>> patterns;
+    Callback onMatch;
+    std::vector<uint32_t> table;                 // переходи: стан * 256 + байт
+    std::vector<std::vector<uint32_t>> outputs;  // зразки, що закінчуються саме в стані
+    std::vector<uint32_t> dictLink;              // найближчий суфіксний стан із власними зразками
+    std::vector<bool> emits;
+    std::vector<Match> pending;
+    size_t maxLen = 0;
+    uint32_t state = 0;
+    size_t consumed = 0;
+    bool resync = false;
+    std::exception_ptr deferred;   // виняток обробника, що виник під час сповіщення рядка
+
+    void advance(const char* p, size_t n) {
+        const unsigned char* q = reinterpret_cast<const unsigned char*>(p);
+        const uint32_t* delta = table.data();
+        const size_t base = consumed;
+        uint32_t s = state;
+        for (size_t i = 0; i < n; ++i) {
+            s = delta[size_t(s) * 256 + q[i]];
+            if (emits[s]) {
+                state = s;
+                consumed = base + i + 1;
+                report(s, consumed);
+            }
+        }
+        state = s;
+        consumed = base + n;
+    }
+
+    // Дочитує рядок від consumed до length. consumed оновлюється перед кожним збігом, тож після
+    // винятку обробника сканування триває з наступного байта; перший виняток відкладається
+    void catch_up(const char* data, size_t length) noexcept {
+        while (consumed < length) {
+            try {
+                advance(data + consumed, length - consumed);
+            } catch (...) {
+                if (!deferred) deferred = std::current_exception();
+            }
+        }
+    }
+
+    // Після зміни чи скидання стан автомата відновлюється з останніх maxLen байтів (від нього залежить лише стан)
+    void resume(const char* data, size_t old) {
+        if (!resync) return;
+        size_t window = std::min(old, maxLen);
+        const unsigned char* q = reinterpret_cast<const unsigned char*>(data + old - window);
+        uint32_t s = 0;
+        for (size_t i = 0; i < window; ++i) s = table[size_t(s) * 256 + q[i]];
+        state = s;
+        resync = false;
+    }
+
+    void rethrow_deferred() {
+        if (!deferred) return;
+        std::exception_ptr e = deferred;
+        deferred = nullptr;
+        std::rethrow_exception(e);
+    }
+
+    void build() {
+        if (patterns.empty()) throw StringException("Matcher needs at least one pattern.");
+        table.assign(256, kNone);
+        outputs.assign(1, {});
+        for (size_t k = 0; k < patterns.size(); ++k) {
+            const String<char>& pat = patterns[k];
+            if (pat.empty()) throw StringException("Matcher patterns must not be empty.");
+            maxLen = std::max(maxLen, pat.size());
+            uint32_t s = 0;
+            for (char ch : pat) {
+                size_t slot = size_t(s) * 256 + static_cast<unsigned char>(ch);
+                if (table[slot] == kNone) {
+                    table[slot] = uint32_t(outputs.size());
+                    outputs.emplace_back();
+                    table.resize(table.size() + 256, kNone);
+                }
+                s = table[slot];
+            }
+            outputs[s].push_back(uint32_t(k));
+        }
+        // BFS: недостатні переходи доповнюються переходами суфіксного посилання
+        size_t states = outputs.size();
+        std::vector<uint32_t> fail(states, 0), queue;
+        dictLink.assign(states, kNone);
+        queue.reserve(states);
+        for (size_t c = 0; c < 256; ++c) {
+            uint32_t& t = table[c];
+            if (t == kNone) t = 0;
+            else queue.push_back(t);
+        }
+        for (size_t head = 0; head < queue.size(); ++head) {
+            uint32_t s = queue[head];
+            uint32_t f = fail[s];
+            dictLink[s] = !outputs[f].empty() ? f : dictLink[f];
+            for (size_t c = 0; c < 256; ++c) {
+                uint32_t& t = table[size_t(s) * 256 + c];
+                uint32_t viaFail = table[size_t(f) * 256 + c];
+                if (t == kNone) {
+                    t = viaFail;
+                } else {
+                    fail[t] = viaFail;
+                    queue.push_back(t);
+                }
+            }
+        }
+        emits.assign(states, false);
+        for (size_t s = 0; s < states; ++s) emits[s] = !outputs[s].empty() || dictLink[s] != kNone;
+    }
+
+    // Усі збіги з кінцем end повідомляються, навіть якщо обробник кинув на одному з них; далі — перший виняток
+    void report(uint32_t s, size_t end) {
+        std::exception_ptr failure;
+        for (uint32_t v = outputs[s].empty() ? dictLink[s] : s; v != kNone; v = dictLink[v])
+            for (uint32_t k : outputs[v]) {
+                const String<char>& pat = patterns[k];
+                Match m{k, end - pat.size(), pat.view()};
+                try {
+                    if (onMatch) onMatch(m);
+                    else pending.push_back(m);
+                } catch (...) {
+                    if (!failure) failure = std::current_exception();
+                }
+            }
+        if (failure) std::rethrow_exception(failure);
+    }
+};
+
+// Відстеження змінених діапазонів рядка (дописування, запис через operator[] і set, modify_range тощо;
+// запис через begin() не відстежується). Діапазони впорядковані й не перетинаються;
+// дописування в кінець розширює останній за O(1). Якщо діапазонів стає більше за kMaxRanges,
+// найближчі зливаються (охоплюють і чисті елементи між ними).
+template <typename T>
+class DirtyTracker : public StringObserver<T> {
+public:
+    struct Range {
+        size_t begin;
+        size_t end;
+    };
+
+    static constexpr size_t kMaxRanges = 64;
+
+    // Спочатку брудний увесь наявний вміст
+    explicit DirtyTracker(String<T>& source) {
+        dirty.reserve(kMaxRanges + 1);
+        mark(0, source.size());
+        source.attach(*this);
+    }
+
+    const std::vector<Range>& ranges() const { return dirty; }
+    bool clean() const { return dirty.empty(); }
+
+    size_t dirty_size() const {
+        size_t total = 0;
+        for (const Range& r : dirty) total += r.end - r.begin;
+        return total;
+    }
+
+    void mark(size_t begin, size_t end) {
+        if (begin >= end) return;
+        if (dirty.empty() || begin > dirty.back().end) {
+            dirty.push_back(Range{begin, end});
+        } else if (begin >= dirty.back().begin) {
+            dirty.back().end = std::max(dirty.back().end, end);
+        } else {
+            auto first = std::lower_bound(dirty.begin(), dirty.end(), begin,
+                                          [](const Range& r, size_t b) { return r.end < b; });
+            auto last = first;
+            while (last != dirty.end() && last->begin <= end) {
+                begin = std::min(begin, last->begin);
+                end = std::max(end, last->end);
+                ++last;
+            }
+            first = dirty.erase(first, last);
+            dirty.insert(first, Range{begin, end});
+        }
+        if (dirty.size() > kMaxRanges) merge_closest();
+    }
+
+    void clear() { dirty.clear(); }
+
+    // Застосовує transformer лише до брудних елементів і позначає рядок чистим
+    // («тримати рядок у верхньому регістрі» коштує пропорційно зміненому)
+    template <typename Trans>
+    void apply_dirty(const Trans& transformer, const CancellationToken* token = nullptr) {
+        String<T>* s = this->source();
+        if (!s) throw StringException("Dirty tracker is detached.");
+        applying = true;
+        try {
+            for (const Range& r : dirty) s->modify_range(r.begin, r.end - r.begin, transformer, token);
+        } catch (...) {
+            applying = false;
+            throw;
+        }
+        applying = false;
+        clear();
+    }
+
+    void on_append(const T*, size_t length, size_t added) override { mark(length - added, length); }
+
+    void on_modify(const T*, size_t, size_t pos, size_t count) override {
+        if (!applying) mark(pos, pos + count);
+    }
+
+    // Місткість зарезервовано в конструкторі, тож mark тут не виділяє пам'ять
+    void on_reset(const T*, size_t length) noexcept override {
+        clear();
+        mark(0, length);
+    }
+
+private:
+    std::vector<Range> dirty;
+    bool applying = false;
+
+    void merge_closest() {
+        size_t best = 1;
+        for (size_t i = 2; i < dirty.size(); ++i)
+            if (dirty[i].begin - dirty[i - 1].end < dirty[best].begin - dirty[best - 1].end) best = i;
+        dirty[best - 1].end = dirty[best].end;
+        dirty.erase(dirty.begin() + best);
+    }
+};
+
+// Хеш рядка, що оновлюється пропорційно зміненому: рядок ділиться на блоки по kBlock елементів,
+// перераховуються лише брудні блоки, результат — хеш масиву хешів блоків.
+// Значення не збігається з hash_bytes усього рядка, але однакове для однакового вмісту.
+template <typename T>
+class IncrementalHash : public DirtyTracker<T> {
+public:
+    static constexpr size_t kBlock = 4096;
+
+    explicit IncrementalHash(String<T>& source) : DirtyTracker<T>(source) {}
+
+    uint64_t value() {
+        String<T>* s = this->source();
+        if (!s) throw StringException("Incremental hash is detached.");
+        size_t n = s->size();
+        size_t blocks = (n + kBlock - 1) / kBlock;
+        blockHashes.resize(blocks);
+        for (const auto& r : this->ranges()) {
+            size_t endBlock = std::min(blocks, (r.end + kBlock - 1) / kBlock);
+            for (size_t b = r.begin / kBlock; b < endBlock; ++b) {
+                size_t begin = b * kBlock, len = std::min(kBlock, n - begin);
+                blockHashes[b] = hash_bytes(s->begin() + begin, len * sizeof(T), b);
+            }
+        }
+        this->clear();
+        return hash_bytes(blockHashes.data(), blocks * sizeof(uint64_t), n);
+    }
+
+private:
+    std::vector<uint64_t> blockHashes;
+};
+
+// Пакетне вилучення підрядків
+// Діапазони (start, len) сортуються, однакові й перекривні зливаються у спільні відрізки, відрізки
+// копіюються в один буфер за зростанням адрес (з попередньою вибіркою наступних), а результати —
+// перегляди в цей буфер. Межі — як у substr: start > size дає OutOfRangeException, len обрізається.
+template <typename T>
+class BatchExtraction {
+public:
+    size_t size() const { return refs.size(); }
+
+    // Перегляд i-го запиту; дійсний, поки живе BatchExtraction
+    StringView<T> operator[](size_t i) const {
+        if (i >= refs.size()) throw OutOfRangeException(i);
+        return StringView<T>(storage.begin() + refs[i].offset, refs[i].length);
+    }
+
+    size_t span_count() const { return spans; }
+    size_t stored_size() const { return storage.size(); }
+
+private:
+    template <typename U>
+    friend BatchExtraction<U> extract_batch(StringView<U>, const std::vector<std::pair<size_t, size_t>>&,
+                                            const CancellationToken*);
+
+    struct Ref {
+        size_t offset;
+        size_t length;
+    };
+
+    String<T> storage;
+    std::vector<Ref> refs;
+    size_t spans = 0;
+};
+
+template <typename T>
+BatchExtraction<T> extract_batch(StringView<T> source, const std::vector<std::pair<size_t, size_t>>& ranges,
+                                 const CancellationToken* token = nullptr) {
+    constexpr size_t kPrefetchAhead = 4;
+    size_t n = source.size();
+    // Запити впорядковуються за адресою; сортуються самі записи, а не індекси — менше промахів кешу
+    struct Request {
+        size_t start, end, index;
+    };
+    std::vector<Request> order(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        size_t start = ranges[i].first;
+        if (start > n) throw OutOfRangeException(start);
+        order[i] = Request{start, start + std::min(ranges[i].second, n - start), i};
+    }
+    if (token) token->check();
+    std::sort(order.begin(), order.end(), [](const Request& a, const Request& b) {
+        return a.start < b.start || (a.start == b.start && a.end < b.end);
+    });
+
+    // Злиття: відрізок [begin, end) у джерелі та його зміщення в буфері
+    struct Span {
+        size_t begin, end, offset;
+    };
+    std::vector<Span> spans;
+    BatchExtraction<T> result;
+    result.refs.resize(ranges.size());
+    size_t stored = 0;
+    for (const Request& r : order) {
+        if (spans.empty() || r.start > spans.back().end) {
+            if (!spans.empty()) stored += spans.back().end - spans.back().begin;
+            spans.push_back(Span{r.start, r.end, stored});
+        } else {
+            spans.back().end = std::max(spans.back().end, r.end);
+        }
+        result.refs[r.index] = {spans.back().offset + (r.start - spans.back().begin), r.end - r.start};
+    }
+    if (!spans.empty()) stored += spans.back().end - spans.back().begin;
+
+    T* out = result.storage.resize_uninitialized(stored);
+    const T* src = source.begin();
+    size_t sinceCheck = 0;
+    for (size_t k = 0; k < spans.size(); ++k) {
+        if (k + kPrefetchAhead < spans.size()) STRING_PREFETCH(src + spans[k + kPrefetchAhead].begin);
+        const Span& sp = spans[k];
+        size_t len = sp.end - sp.begin;
+        if (token && (sinceCheck += len + 1) >= CancellationToken::kCheckInterval) {
+            token->check();
+            sinceCheck = 0;
+        }
+        std::copy(src + sp.begin, src + sp.end, out + sp.offset);
+    }
+    result.spans = spans.size();
+    return result;
+}
+
+template <typename T>
+BatchExtraction<T> extract_batch(const String<T>& source, const std::vector<std::pair<size_t, size_t>>& ranges,
+                                 const CancellationToken* token = nullptr) {
+    return extract_batch(source.view(), ranges, token);
+}
+
+// Arrow C Data Interface (https://arrow.apache.org/docs/format/CDataInterface.html), без залежності від Arrow
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+}
+#endif
+
+// Колонка рядків у форматі Arrow: суцільний буфер UTF-8 і масив зміщень (n + 1 значення).
+// Зміщення 32-бітні (формат "u"), доки буфер не перевищить INT32_MAX байтів, далі — 64-бітні ("U").
+// export_to передає буфери колонки в ArrowArray без копіювання; звільняє їх release споживача.
+class StringColumn {
+public:
+    StringColumn() { offsets32.push_back(0); }
+
+    void reserve(size_t count, size_t bytes) {
+        payload.reserve(bytes);
+        if (wide) offsets64.reserve(count + 1);
+        else offsets32.reserve(count + 1);
+    }
+
+    // Рядки char і char8_t копіюються як є, char16_t/char32_t/wchar_t кодуються в UTF-8 (UTF-16 — з парами
+    // сурогатів; непарні сурогати й значення понад 0x10FFFF замінюються на U+FFFD)
+    template <typename T>
+    void append(StringView<T> s) {
+        static_assert(kUtf8CodeUnit<T> || kUtf8Transcodable<T>, "StringColumn: unsupported character type");
+        size_t old = payload.size();
+        size_t bytes = kUtf8CodeUnit<T> ? s.size() : utf8_units_length(s.begin(), s.size());
+        if (bytes > SIZE_MAX - old) throw std::bad_alloc();
+        char* w = payload.resize_uninitialized(old + bytes) + old;
+        if constexpr (kUtf8CodeUnit<T>) {
+            if (bytes) std::memcpy(w, s.begin(), bytes);
+        } else {
+            utf8_encode_units(s.begin(), s.size(), w);
+        }
+        push_offset(payload.size());
+    }
+
+    template <typename T>
+    void append(const String<T>& s) { append(s.view()); }
+
+    size_t size() const { return wide ? offsets64.size() - 1 : offsets32.size() - 1; }
+    size_t payload_size() const { return payload.size(); }
+    bool large() const { return wide; }
+
+    StringView<char> operator[](size_t i) const {
+        if (i >= size()) throw OutOfRangeException(i);
+        size_t begin = wide ? size_t(offsets64[i]) : size_t(offsets32[i]);
+        size_t end = wide ? size_t(offsets64[i + 1]) : size_t(offsets32[i + 1]);
+        return payload.view().substr(begin, end - begin);
+    }
+
+    // Переносить колонку в array/schema (обидві структури заповнюються; колонка стає порожньою)
+    void export_to(ArrowArray* array, ArrowSchema* schema, const char* name = "") {
+        ExportedSchema* s = new ExportedSchema{name ? name : "", wide ? "U" : "u"};
+        ExportedArray* a;
+        try {
+            a = new ExportedArray{};
+        } catch (...) {
+            delete s;
+            throw;
+        }
+        a->length = int64_t(size());
+        a->payload = std::move(payload);
+        a->offsets32 = std::move(offsets32);
+        a->offsets64 = std::move(offsets64);
+        a->buffers[0] = nullptr;  // без null-значень бітова маска не потрібна
+        a->buffers[1] = wide ? static_cast<const void*>(a->offsets64.data()) : static_cast<const void*>(a->offsets32.data());
+        a->buffers[2] = a->payload.empty() ? static_cast<const void*>(kEmptyPayload) : a->payload.begin();
+
+        schema->format = s->format;
+        schema->name = s->name.c_str();
+        schema->metadata = nullptr;
+        schema->flags = 0;
+        schema->n_children = 0;
+        schema->children = nullptr;
+        schema->dictionary = nullptr;
+        schema->release = &release_schema;
+        schema->private_data = s;
+
+        array->length = a->length;
+        array->null_count = 0;
+        array->offset = 0;
+        array->n_buffers = 3;
+        array->n_children = 0;
+        array->buffers = a->buffers;
+        array->children = nullptr;
+        array->dictionary = nullptr;
+        array->release = &release_array;
+        array->private_data = a;
+
+        payload = String<char>();
+        offsets32.assign(1, 0);
+        offsets64.clear();
+        wide = false;
+    }
+
+private:
+    static constexpr char kEmptyPayload[1] = {0};
+
+    struct ExportedSchema {
+        std::string name;
+        const char* format;
+    };
+
+    struct ExportedArray {
+        int64_t length = 0;
+        String<char> payload;
+        std::vector<int32_t> offsets32;
+        std::vector<int64_t> offsets64;
+        const void* buffers[3] = {};
+    };
+
+    String<char> payload;
+    std::vector<int32_t> offsets32;
+    std::vector<int64_t> offsets64;
+    bool wide = false;
+
+    void push_offset(size_t end) {
+        if (!wide && end > size_t(INT32_MAX)) {
+            offsets64.assign(offsets32.begin(), offsets32.end());
+            offsets32.clear();
+            offsets32.shrink_to_fit();
+            wide = true;
+        }
+        if (wide) offsets64.push_back(int64_t(end));
+        else offsets32.push_back(int32_t(end));
+    }
+
+    static void release_schema(ArrowSchema* schema) {
+        delete static_cast<ExportedSchema*>(schema->private_data);
+        schema->release = nullptr;
+    }
+
+    static void release_array(ArrowArray* array) {
+        delete static_cast<ExportedArray*>(array->private_data);
+        array->release = nullptr;
+    }
+};
+
+#if defined(STRING_BENCHMARKS)
+// Вимірювання продуктивності: збирання з -DSTRING_BENCHMARKS, запуск "lb4 --bench <назва> [параметри]"
+
+// Лічильник промахів dTLB під час читання (perf_event_open, лише Linux); без доступу — valid() == false
+class TlbMissCounter {
+public:
+    TlbMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    TlbMissCounter(const TlbMissCounter&) = delete;
+    TlbMissCounter& operator=(const TlbMissCounter&) = delete;
+
+    ~TlbMissCounter() {
+#if defined(__linux__)
+        if (fd >= 0) close(fd);
+#endif
+    }
+
+    bool valid() const { return fd >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        if (fd < 0) return;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    uint64_t stop() {
+        uint64_t misses = 0;
+#if defined(__linux__)
+        if (fd < 0) return 0;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &misses, sizeof(misses)) != ssize_t(sizeof(misses))) misses = 0;
+#endif
+        return misses;
+    }
+
+private:
+    int fd = -1;
 };
 
+inline double bench_ms(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+}
+
+// Прохід по буферу з підрахунком часу й промахів TLB
+template <typename Body>
+void bench_tlb_pass(const char* label, Body body) {
+    TlbMissCounter counter;
+    auto started = std::chrono::steady_clock::now();
+    counter.start();
+    body();
+    uint64_t misses = counter.stop();
+    std::cout << "  " << label << ": " << bench_ms(started) << " ms";
+    if (counter.valid()) std::cout << ", dTLB read misses " << misses;
+    else std::cout << ", dTLB read misses n/a (perf_event_open unavailable)";
+    std::cout << '\n';
+}
+
+// Перетворення GB-масштабу над буфером String<char> (рівень mmap + MADV_HUGEPAGE) проти такого ж
+// буфера на сторінках 4 КіБ: послідовне перетворення регістру та випадкові звернення
+inline void bench_tlb(size_t mib) {
+    const size_t bytes = mib << 20;
+    auto run = [bytes](char* p) {
+        for (size_t i = 0; i < bytes; ++i) p[i] = char('a' + i % 26);
+        bench_tlb_pass("sequential to_upper", [p, bytes] {
+            for (size_t i = 0; i < bytes; ++i) p[i] = char(p[i] & ~0x20);
+        });
+        bench_tlb_pass("random 16M reads   ", [p, bytes] {
+            uint64_t x = 0x9E3779B97F4A7C15ull, sum = 0;
+            for (size_t k = 0; k < (size_t(1) << 24); ++k) {
+                x ^= x << 13;
+                x ^= x >> 7;
+                x ^= x << 17;
+                sum += uint8_t(p[x % bytes]);
+            }
+            volatile uint64_t sink = sum;
+            (void)sink;
+        });
+    };
+
+    std::cout << "Buffer " << mib << " MiB, String<char> (huge-page tier):\n";
+    {
+        String<char> s;
+        run(s.resize_uninitialized(bytes));
+    }
+
+    std::cout << "Buffer " << mib << " MiB, 4 KiB pages:\n";
+#if defined(__linux__) && defined(MADV_NOHUGEPAGE)
+    void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+    madvise(p, bytes, MADV_NOHUGEPAGE);
+    run(static_cast<char*>(p));
+    munmap(p, bytes);
+#else
+    std::vector<char> plain(bytes);
+    run(plain.data());
+#endif
+}
+
+// Багатопотокова круговерть коротких буферів: кожен потік створює пачки підрядків по 8..64 байти,
+// половину звільняє сам, а половину віддає сусідньому потоку (звільнення чужих блоків)
+template <typename Make>
+double bench_churn_run(unsigned threads, size_t rounds, Make make) {
+    using Item = decltype(make(size_t(0), size_t(0)));
+    constexpr size_t kBatch = 256;
+    struct Mailbox {
+        std::mutex mutex;
+        std::vector<Item> items;
+    };
+    std::vector<Mailbox> boxes(threads);
+    auto started = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::vector<Item> batch, incoming;
+            batch.reserve(kBatch);
+            uint64_t x = 0x9E3779B97F4A7C15ull * (t + 1);
+            for (size_t r = 0; r < rounds; ++r) {
+                for (size_t i = 0; i < kBatch; ++i) {
+                    x ^= x << 13;
+                    x ^= x >> 7;
+                    x ^= x << 17;
+                    batch.push_back(make(size_t(x % 4096), size_t(8 + (x >> 32) % 57)));
+                }
+                {
+                    Mailbox& next = boxes[(t + 1) % threads];
+                    std::lock_guard<std::mutex> lock(next.mutex);
+                    for (size_t i = kBatch / 2; i < kBatch; ++i) next.items.push_back(std::move(batch[i]));
+                }
+                batch.clear();
+                {
+                    std::lock_guard<std::mutex> lock(boxes[t].mutex);
+                    incoming.swap(boxes[t].items);
+                }
+                incoming.clear();
+            }
+        });
+    }
+    for (std::thread& w : workers) w.join();
+    return bench_ms(started);
+}
+
+inline void bench_churn(unsigned maxThreads, size_t rounds) {
+    String<char> source;
+    for (size_t i = 0; i < 4096 + 64; ++i) source += char('a' + i % 26);
+    const char* raw = source.c_str();
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        double ops = double(threads) * double(rounds) * 256;
+        double pool = bench_churn_run(threads, rounds, [&source](size_t off, size_t len) {
+            return source.substr(off, len);
+        });
+        double global = bench_churn_run(threads, rounds, [raw](size_t off, size_t len) {
+            return std::vector<char>(raw + off, raw + off + len);
+        });
+        std::cout << threads << " threads: String<char> (StringPool) " << ops / pool / 1000 << " Mops/s, "
+                  << "std::vector<char> (global new) " << ops / global / 1000 << " Mops/s\n";
+    }
+}
+
+// Матриця пошуку: довжина зразка × розмір алфавіту, Searcher (попередньо скомпільований) проти
+// std::string::find; текст і зразок — випадкові над тим самим алфавітом, входження перекривні
+inline void bench_searcher(size_t mib) {
+    const size_t lengths[] = {1, 2, 4, 8, 16, 32, 64, 256};
+    const size_t alphabets[] = {2, 4, 26, 256};
+    const char* names[] = {"empty", "single-byte", "pair-filter", "horspool"};
+    uint64_t x = 0x9E3779B97F4A7C15ull;
+    auto next = [&x] {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        return x;
+    };
+    std::cout << "Text " << mib << " MiB; throughput in GB/s\n"
+              << "pattern alphabet algorithm    Searcher std::find matches\n";
+    for (size_t sigma : alphabets) {
+        std::string text(mib << 20, '\0');
+        for (char& c : text) c = char(sigma == 256 ? next() : 'a' + next() % sigma);
+        for (size_t m : lengths) {
+            std::string pattern(m, '\0');
+            for (char& c : pattern) c = char(sigma == 256 ? next() : 'a' + next() % sigma);
+            Searcher searcher(StringView<char>(pattern.data(), m));
+            StringView<char> view(text.data(), text.size());
+            auto started = std::chrono::steady_clock::now();
+            size_t found = searcher.count(view);
+            double fast = bench_ms(started);
+            started = std::chrono::steady_clock::now();
+            size_t expected = 0;
+            for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) ++expected;
+            double plain = bench_ms(started);
+            if (found != expected) throw StringException("Searcher benchmark: match count differs from std::string::find.");
+            double gb = double(text.size()) / 1e6;
+            std::cout << m << (m < 10 ? "       " : m < 100 ? "      " : "     ") << sigma
+                      << (sigma < 10 ? "        " : sigma < 100 ? "       " : "      ")
+                      << names[int(searcher.algorithm())] << "  " << gb / fast << "  " << gb / plain << "  " << found
+                      << '\n';
+        }
+    }
+}
+
+inline int run_benchmarks(int argc, char* argv[]) {
+    std::string name = argc > 0 ? argv[0] : "";
+    auto arg = [argc, argv](int i, size_t fallback) {
+        return argc > i ? size_t(std::strtoull(argv[i], nullptr, 10)) : fallback;
+    };
+    if (name == "tlb") {
+        bench_tlb(arg(1, 1024));
+        return 0;
+    }
+    if (name == "churn") {
+        bench_churn(unsigned(arg(1, 8)), arg(2, 20000));
+        return 0;
+    }
+    if (name == "search") {
+        bench_searcher(arg(1, 32));
+        return 0;
+    }
+    std::cerr << "Usage: --bench tlb [MiB] | churn [max threads] [rounds] | search [MiB]\n";
+    return 1;
+}
+#endif
+
 // Головна функція з меню
 
 void printMenu() {
@@ -323,12 +6782,20 @@ void printMenu() {
               << "6. Додати символ в кінець\n"
               << "7. Конкатенація з іншим рядком\n"
               << "8. Помножити рядок на число\n"
-              << "9. Застосувати перетворення ToUpperChar\n"
+              << "9. Перевести рядок у верхній регістр (Unicode)\n"
               << "0. Вийти\n"
               << "Виберіть опцію: ";
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+#if defined(STRING_BENCHMARKS)
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0) return run_benchmarks(argc - 2, argv + 2);
+#else
+    (void)argc;
+    (void)argv;
+#endif
+    // Обмеження для інтерактивного режиму: велике множення (опція 8) дає помилку, а не OOM
+    MemoryBudget::set_limits(size_t(256) << 20, size_t(1) << 30);
     String<char> s;
     bool running = true;
 
@@ -388,8 +6855,7 @@ int main() {
                 break;
             }
             case 9: {
-                ToUpperChar toUpper;
-                s.apply(toUpper);
+                s = to_upper(s);
                 std::cout << "Після перетворення в верхній регістр: " << s << '\n';
                 break;
             }